@@ -0,0 +1,154 @@
+/**
+ * @file BlitBenchmark.cpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Benchmark of pixel-wise copies versus blits and sprites
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 license
+ */
+
+//-------------------------------------------------------------------
+// Imports
+//-------------------------------------------------------------------
+
+#include "PixelVector.hpp"
+#include "Sprite.hpp"
+#include "Benchmark.hpp"
+
+using namespace std;
+
+//-------------------------------------------------------------------
+// Globals
+//-------------------------------------------------------------------
+
+#define MATRIX_SIZE 64
+#define SPRITE_SIZE 16
+
+//-------------------------------------------------------------------
+// Auxiliary
+//-------------------------------------------------------------------
+
+// Ring outline: most pixels are transparent (black)
+PixelMatrix sparse_image()
+{
+    PixelMatrix image(SPRITE_SIZE, SPRITE_SIZE);
+    int center = SPRITE_SIZE / 2;
+    int outer = (center - 1) * (center - 1);
+    int inner = (center - 2) * (center - 2);
+    image.forEach(
+        [&](size_t r, size_t c, Pixel &pixel)
+        {
+            int dr = static_cast<int>(r) - center;
+            int dc = static_cast<int>(c) - center;
+            int distance = (dr * dr) + (dc * dc);
+            if ((distance <= outer) && (distance > inner))
+                pixel = 0xFFFFFF;
+        });
+    return image;
+}
+
+//-------------------------------------------------------------------
+// Benchmarks
+//-------------------------------------------------------------------
+
+void benchmark1()
+{
+    cout << "- Opaque " << SPRITE_SIZE << "x" << SPRITE_SIZE
+         << " copy (" << MATRIX_SIZE << "x" << MATRIX_SIZE
+         << " pixels) -" << endl;
+    PixelMatrix pixels(MATRIX_SIZE, MATRIX_SIZE);
+    PixelMatrix image(SPRITE_SIZE, SPRITE_SIZE);
+    image.fillRainbow(0, 65536 / image.size());
+    Sprite sprite(image);
+    size_t offset = 0;
+
+    // Note: one sprite per run
+    double baseline = items_per_second(
+        1,
+        [&]()
+        {
+            offset = (offset + 1) % (MATRIX_SIZE - SPRITE_SIZE);
+            for (size_t r = 0; r < SPRITE_SIZE; r++)
+                for (size_t c = 0; c < SPRITE_SIZE; c++)
+                    pixels.at(offset + r, offset + c) = image.at(r, c);
+            keep(pixels.at(offset, offset).red);
+        });
+    report("Pixel-wise copy", baseline);
+
+    double rate = items_per_second(
+        1,
+        [&]()
+        {
+            offset = (offset + 1) % (MATRIX_SIZE - SPRITE_SIZE);
+            pixels.blit(image, image.bounds(), offset, offset);
+            keep(pixels.at(offset, offset).red);
+        });
+    report("blit()", rate, baseline);
+
+    rate = items_per_second(
+        1,
+        [&]()
+        {
+            offset = (offset + 1) % (MATRIX_SIZE - SPRITE_SIZE);
+            sprite.draw(pixels, offset, offset);
+            keep(pixels.at(offset, offset).red);
+        });
+    report("Sprite::draw()", rate, baseline);
+}
+
+void benchmark2()
+{
+    cout << "- Sparse " << SPRITE_SIZE << "x" << SPRITE_SIZE
+         << " copy (" << MATRIX_SIZE << "x" << MATRIX_SIZE
+         << " pixels) -" << endl;
+    PixelMatrix pixels(MATRIX_SIZE, MATRIX_SIZE);
+    PixelMatrix image = sparse_image();
+    Sprite sprite(image, Pixel());
+    size_t offset = 0;
+
+    double baseline = items_per_second(
+        1,
+        [&]()
+        {
+            offset = (offset + 1) % (MATRIX_SIZE - SPRITE_SIZE);
+            for (size_t r = 0; r < SPRITE_SIZE; r++)
+                for (size_t c = 0; c < SPRITE_SIZE; c++)
+                    if (image.at(r, c) != Pixel())
+                        pixels.at(offset + r, offset + c) = image.at(r, c);
+            keep(pixels.at(offset, offset).red);
+        });
+    report("Pixel-wise copy", baseline);
+
+    double rate = items_per_second(
+        1,
+        [&]()
+        {
+            offset = (offset + 1) % (MATRIX_SIZE - SPRITE_SIZE);
+            pixels.blit(image, image.bounds(), offset, offset, Pixel());
+            keep(pixels.at(offset, offset).red);
+        });
+    report("blit() (color key)", rate, baseline);
+
+    rate = items_per_second(
+        1,
+        [&]()
+        {
+            offset = (offset + 1) % (MATRIX_SIZE - SPRITE_SIZE);
+            sprite.draw(pixels, offset, offset);
+            keep(pixels.at(offset, offset).red);
+        });
+    report("Sprite::draw()", rate, baseline);
+}
+
+//-------------------------------------------------------------------
+// MAIN
+//-------------------------------------------------------------------
+
+int main()
+{
+    benchmark1();
+    benchmark2();
+    return 0;
+}
@@ -0,0 +1,121 @@
+/**
+ * @file BlurBenchmark.cpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Benchmark of naive versus running-sum blurs
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 license
+ */
+
+//-------------------------------------------------------------------
+// Imports
+//-------------------------------------------------------------------
+
+#include "PixelVector.hpp"
+#include "Benchmark.hpp"
+#include <string>
+
+using namespace std;
+
+//-------------------------------------------------------------------
+// Auxiliary
+//-------------------------------------------------------------------
+
+// Naive box blur: (2*radius+1)^2 reads per pixel through at()
+void naive_blur(PixelMatrix &pixels, PixelMatrix &buffer, size_t radius)
+{
+    ptrdiff_t rows = pixels.row_count();
+    ptrdiff_t columns = pixels.column_count();
+    ptrdiff_t r = radius;
+    for (ptrdiff_t row = 0; row < rows; row++)
+        for (ptrdiff_t col = 0; col < columns; col++)
+        {
+            uint32_t red = 0, green = 0, blue = 0;
+            for (ptrdiff_t i = row - r; i <= row + r; i++)
+                for (ptrdiff_t j = col - r; j <= col + r; j++)
+                {
+                    const Pixel &pixel = pixels.at(
+                        min(max(i, ptrdiff_t(0)), rows - 1),
+                        min(max(j, ptrdiff_t(0)), columns - 1));
+                    red += pixel.red;
+                    green += pixel.green;
+                    blue += pixel.blue;
+                }
+            uint32_t count = (2 * r + 1) * (2 * r + 1);
+            Pixel &pixel = buffer.at(row, col);
+            pixel.red = red / count;
+            pixel.green = green / count;
+            pixel.blue = blue / count;
+        }
+    pixels = buffer;
+}
+
+//-------------------------------------------------------------------
+// Benchmarks
+//-------------------------------------------------------------------
+
+void benchmark(size_t size)
+{
+    cout << "- Blur (" << size << "x" << size << " pixels) -" << endl;
+    PixelMatrix pixels(size, size);
+    PixelMatrix buffer(size, size);
+    pixels.fillRainbow(0, 65536 / pixels.size());
+
+    // Note: one frame per run
+    double baseline = items_per_second(
+        1,
+        [&]()
+        {
+            naive_blur(pixels, buffer, 1);
+            keep(pixels.at(0, 0).red);
+        });
+    report("Naive 3x3 blur", baseline);
+
+    for (size_t radius : {1, 2, 4, 8})
+    {
+        string suffix = " (radius " + to_string(radius) + ")";
+        double rate;
+        if (radius > 1)
+        {
+            rate = items_per_second(
+                1,
+                [&]()
+                {
+                    naive_blur(pixels, buffer, radius);
+                    keep(pixels.at(0, 0).red);
+                });
+            report("Naive blur" + suffix, rate, baseline);
+        }
+
+        rate = items_per_second(
+            1,
+            [&]()
+            {
+                pixels.boxBlur(radius);
+                keep(pixels.at(0, 0).red);
+            });
+        report("boxBlur()" + suffix, rate, baseline);
+
+        rate = items_per_second(
+            1,
+            [&]()
+            {
+                pixels.gaussianBlur(radius);
+                keep(pixels.at(0, 0).red);
+            });
+        report("gaussianBlur()" + suffix, rate, baseline);
+    }
+}
+
+//-------------------------------------------------------------------
+// MAIN
+//-------------------------------------------------------------------
+
+int main()
+{
+    benchmark(32);
+    benchmark(64);
+    return 0;
+}
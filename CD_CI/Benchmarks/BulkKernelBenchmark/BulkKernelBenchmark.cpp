@@ -0,0 +1,203 @@
+/**
+ * @file BulkKernelBenchmark.cpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Benchmark of whole-frame pixel kernels
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 license
+ */
+
+//-------------------------------------------------------------------
+// Imports
+//-------------------------------------------------------------------
+
+#include "PixelVector.hpp"
+#include "Benchmark.hpp"
+
+using namespace std;
+
+//-------------------------------------------------------------------
+// Globals
+//-------------------------------------------------------------------
+
+#define PIXEL_COUNT 1024
+
+//-------------------------------------------------------------------
+// Benchmarks
+//-------------------------------------------------------------------
+
+void benchmark1()
+{
+    cout << "- Fill (" << PIXEL_COUNT << " pixels) -" << endl;
+    PixelVector pixels(PIXEL_COUNT);
+
+    double baseline = items_per_second(
+        PIXEL_COUNT,
+        [&pixels]()
+        {
+            for (size_t i = 0; i < pixels.size(); i++)
+                pixels[i] = 0x102030;
+            keep(pixels[PIXEL_COUNT / 2].red);
+        });
+    report("Per-pixel loop", baseline);
+
+    double rate = items_per_second(
+        PIXEL_COUNT,
+        [&pixels]()
+        {
+            pixels.fill(0x102030);
+            keep(pixels[PIXEL_COUNT / 2].red);
+        });
+    report("PixelVector::fill()", rate, baseline);
+}
+
+void benchmark2()
+{
+    cout << "- Scale (" << PIXEL_COUNT << " pixels) -" << endl;
+    PixelVector pixels(PIXEL_COUNT, 0xFF8040);
+
+    double baseline = items_per_second(
+        PIXEL_COUNT,
+        [&pixels]()
+        {
+            for (size_t i = 0; i < pixels.size(); i++)
+                pixels[i].dim(250);
+            keep(pixels[PIXEL_COUNT / 2].red);
+        });
+    report("Pixel::dim() loop", baseline);
+
+    double rate = items_per_second(
+        PIXEL_COUNT,
+        [&pixels]()
+        {
+            pixels.scale(250);
+            keep(pixels[PIXEL_COUNT / 2].red);
+        });
+    report("PixelVector::scale()", rate, baseline);
+}
+
+void benchmark3()
+{
+    cout << "- Additive blend (" << PIXEL_COUNT << " pixels) -" << endl;
+    PixelVector pixels(PIXEL_COUNT, 0x102030);
+    PixelVector other(PIXEL_COUNT, 0x010101);
+
+    double baseline = items_per_second(
+        PIXEL_COUNT,
+        [&pixels, &other]()
+        {
+            for (size_t i = 0; i < pixels.size(); i++)
+            {
+                unsigned int r = pixels[i].red + other[i].red;
+                unsigned int g = pixels[i].green + other[i].green;
+                unsigned int b = pixels[i].blue + other[i].blue;
+                pixels[i].red = (r > 255) ? 255 : r;
+                pixels[i].green = (g > 255) ? 255 : g;
+                pixels[i].blue = (b > 255) ? 255 : b;
+            }
+            keep(pixels[PIXEL_COUNT / 2].red);
+        });
+    report("Per-channel loop", baseline);
+
+    double rate = items_per_second(
+        PIXEL_COUNT,
+        [&pixels, &other]()
+        {
+            pixels.blendAdd(other);
+            keep(pixels[PIXEL_COUNT / 2].red);
+        });
+    report("PixelVector::blendAdd()", rate, baseline);
+}
+
+void benchmark4()
+{
+    cout << "- Maximum blend (" << PIXEL_COUNT << " pixels) -" << endl;
+    PixelVector pixels(PIXEL_COUNT, 0x102030);
+    PixelVector other(PIXEL_COUNT, 0x302010);
+
+    double baseline = items_per_second(
+        PIXEL_COUNT,
+        [&pixels, &other]()
+        {
+            for (size_t i = 0; i < pixels.size(); i++)
+            {
+                pixels[i].red = max(pixels[i].red, other[i].red);
+                pixels[i].green = max(pixels[i].green, other[i].green);
+                pixels[i].blue = max(pixels[i].blue, other[i].blue);
+            }
+            keep(pixels[PIXEL_COUNT / 2].red);
+        });
+    report("Per-channel loop", baseline);
+
+    double rate = items_per_second(
+        PIXEL_COUNT,
+        [&pixels, &other]()
+        {
+            pixels.blendMax(other);
+            keep(pixels[PIXEL_COUNT / 2].red);
+        });
+    report("PixelVector::blendMax()", rate, baseline);
+}
+
+void benchmark5()
+{
+    cout << "- Crossfade (" << PIXEL_COUNT << " pixels) -" << endl;
+    PixelVector from(PIXEL_COUNT, 0x102030);
+    PixelVector to(PIXEL_COUNT, 0xF0E0D0);
+    PixelVector pixels(PIXEL_COUNT);
+
+    double baseline = items_per_second(
+        PIXEL_COUNT,
+        [&pixels, &from, &to]()
+        {
+            float t = 100.0f / 255.0f;
+            for (size_t i = 0; i < pixels.size(); i++)
+            {
+                pixels[i].red = from[i].red + (to[i].red - from[i].red) * t;
+                pixels[i].green =
+                    from[i].green + (to[i].green - from[i].green) * t;
+                pixels[i].blue =
+                    from[i].blue + (to[i].blue - from[i].blue) * t;
+            }
+            keep(pixels[PIXEL_COUNT / 2].red);
+        });
+    report("Floating point lerp", baseline);
+
+    double rate = items_per_second(
+        PIXEL_COUNT,
+        [&pixels, &from, &to]()
+        {
+            for (size_t i = 0; i < pixels.size(); i++)
+            {
+                pixels[i] = from[i];
+                pixels[i].blend(to[i], 100);
+            }
+            keep(pixels[PIXEL_COUNT / 2].red);
+        });
+    report("Pixel::blend() loop", rate, baseline);
+
+    rate = items_per_second(
+        PIXEL_COUNT,
+        [&pixels, &from, &to]()
+        {
+            pixels.crossfade(from, to, 100);
+            keep(pixels[PIXEL_COUNT / 2].red);
+        });
+    report("PixelVector::crossfade()", rate, baseline);
+}
+
+//-------------------------------------------------------------------
+// MAIN
+//-------------------------------------------------------------------
+
+int main()
+{
+    benchmark1();
+    benchmark2();
+    benchmark3();
+    benchmark4();
+    benchmark5();
+    return 0;
+}
@@ -0,0 +1,138 @@
+/**
+ * @file HslBenchmark.cpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Benchmark of HSL to RGB conversion
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 license
+ */
+
+//-------------------------------------------------------------------
+// Imports
+//-------------------------------------------------------------------
+
+#include "PixelVector.hpp"
+#include "Benchmark.hpp"
+#include <cmath>
+
+using namespace std;
+
+//-------------------------------------------------------------------
+// Globals
+//-------------------------------------------------------------------
+
+#define PIXEL_COUNT 1024
+
+//-------------------------------------------------------------------
+// Auxiliary
+//-------------------------------------------------------------------
+
+/**
+ * @brief Floating-point HSL to RGB conversion (former implementation)
+ *
+ */
+void float_hsl(Pixel &p, unsigned int hue, uint8_t saturation, uint8_t luminance)
+{
+    int c_255 = ((255 - ::std::abs((2 * luminance) - 255)) * saturation) / 254;
+    double x_aux =
+        ::std::abs(::std::fmod((double)hue / 60.0, (double)2.0) - 1.0);
+    int x_255 = c_255 * (10000 - (int)(x_aux * 10000)) / 10000;
+    int m_255 = luminance - (c_255 / 2);
+    if (hue >= 300)
+    {
+        p.red = c_255 + m_255;
+        p.green = m_255;
+        p.blue = x_255 + m_255;
+    }
+    else if (hue >= 240)
+    {
+        p.red = x_255 + m_255;
+        p.green = m_255;
+        p.blue = c_255 + m_255;
+    }
+    else if (hue >= 180)
+    {
+        p.red = m_255;
+        p.green = x_255 + m_255;
+        p.blue = c_255 + m_255;
+    }
+    else if (hue >= 120)
+    {
+        p.red = m_255;
+        p.green = c_255 + m_255;
+        p.blue = x_255 + m_255;
+    }
+    else if (hue >= 60)
+    {
+        p.red = x_255 + m_255;
+        p.green = c_255 + m_255;
+        p.blue = m_255;
+    }
+    else
+    {
+        p.red = c_255 + m_255;
+        p.green = x_255 + m_255;
+        p.blue = m_255;
+    }
+}
+
+//-------------------------------------------------------------------
+// Benchmarks
+//-------------------------------------------------------------------
+
+void benchmark1()
+{
+    cout << "- Rainbow fill (" << PIXEL_COUNT << " pixels) -" << endl;
+    PixelVector pixels(PIXEL_COUNT);
+
+    double baseline = items_per_second(
+        PIXEL_COUNT,
+        [&pixels]()
+        {
+            for (size_t i = 0; i < pixels.size(); i++)
+                float_hsl(pixels[i], (i * 360) / PIXEL_COUNT, 255, 127);
+            keep(pixels[PIXEL_COUNT / 2].red);
+        });
+    report("Floating point (former hsl())", baseline);
+
+    double rate = items_per_second(
+        PIXEL_COUNT,
+        [&pixels]()
+        {
+            for (size_t i = 0; i < pixels.size(); i++)
+                pixels[i].hsl((i * 360) / PIXEL_COUNT, 255, 127);
+            keep(pixels[PIXEL_COUNT / 2].red);
+        });
+    report("Integer hsl()", rate, baseline);
+
+    rate = items_per_second(
+        PIXEL_COUNT,
+        [&pixels]()
+        {
+            for (size_t i = 0; i < pixels.size(); i++)
+                pixels[i].hsl16((i * 65536) / PIXEL_COUNT, 255, 127);
+            keep(pixels[PIXEL_COUNT / 2].red);
+        });
+    report("Fixed point hsl16()", rate, baseline);
+
+    rate = items_per_second(
+        PIXEL_COUNT,
+        [&pixels]()
+        {
+            pixels.fillRainbow(0, 65536 / PIXEL_COUNT);
+            keep(pixels[PIXEL_COUNT / 2].red);
+        });
+    report("PixelVector::fillRainbow()", rate, baseline);
+}
+
+//-------------------------------------------------------------------
+// MAIN
+//-------------------------------------------------------------------
+
+int main()
+{
+    benchmark1();
+    return 0;
+}
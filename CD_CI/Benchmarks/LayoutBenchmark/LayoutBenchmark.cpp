@@ -0,0 +1,88 @@
+/**
+ * @file LayoutBenchmark.cpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Benchmark of LED matrix index mapping
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 license
+ */
+
+//-------------------------------------------------------------------
+// Imports
+//-------------------------------------------------------------------
+
+#include "PixelDriver.hpp"
+#include "Benchmark.hpp"
+
+using namespace std;
+
+//-------------------------------------------------------------------
+// Globals
+//-------------------------------------------------------------------
+
+using Panel = LedMatrixLayout<
+    16,
+    32,
+    LedMatrixFirstPixel::bottom_right,
+    LedMatrixArrangement::columns,
+    LedMatrixWiring::serpentine>;
+
+static constexpr auto canonical_table = Panel::canonicalTable();
+
+// Note: not constant, so the compiler cannot fold it
+LedMatrixParameters runtime_params = Panel::parameters;
+
+//-------------------------------------------------------------------
+// Benchmarks
+//-------------------------------------------------------------------
+
+void benchmark1()
+{
+    cout << "- Canonical index (" << Panel::pixel_count << " pixels) -"
+         << endl;
+
+    double baseline = items_per_second(
+        Panel::pixel_count,
+        []()
+        {
+            size_t sum = 0;
+            for (size_t i = 0; i < runtime_params.size(); i++)
+                sum += runtime_params.canonicalIndex(i);
+            keep(sum);
+        });
+    report("LedMatrixParameters::canonicalIndex()", baseline);
+
+    double rate = items_per_second(
+        Panel::pixel_count,
+        []()
+        {
+            size_t sum = 0;
+            for (size_t i = 0; i < Panel::pixel_count; i++)
+                sum += Panel::canonicalIndex(i);
+            keep(sum);
+        });
+    report("LedMatrixLayout::canonicalIndex()", rate, baseline);
+
+    rate = items_per_second(
+        Panel::pixel_count,
+        []()
+        {
+            size_t sum = 0;
+            for (size_t i = 0; i < Panel::pixel_count; i++)
+                sum += canonical_table[i];
+            keep(sum);
+        });
+    report("Constexpr table", rate, baseline);
+}
+
+//-------------------------------------------------------------------
+// MAIN
+//-------------------------------------------------------------------
+
+int main()
+{
+    benchmark1();
+    return 0;
+}
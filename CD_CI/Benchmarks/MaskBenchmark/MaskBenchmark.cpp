@@ -0,0 +1,103 @@
+/**
+ * @file MaskBenchmark.cpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Benchmark of full-color layers versus one-bit masks
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 license
+ */
+
+//-------------------------------------------------------------------
+// Imports
+//-------------------------------------------------------------------
+
+#include "PixelMask.hpp"
+#include "Benchmark.hpp"
+
+using namespace std;
+
+//-------------------------------------------------------------------
+// Globals
+//-------------------------------------------------------------------
+
+#define MATRIX_SIZE 64
+
+//-------------------------------------------------------------------
+// Benchmarks
+//-------------------------------------------------------------------
+
+void benchmark1()
+{
+    cout << "- Tint a sparse layer (" << MATRIX_SIZE << "x" << MATRIX_SIZE
+         << " pixels) -" << endl;
+    PixelMatrix pixels(MATRIX_SIZE, MATRIX_SIZE);
+    PixelMatrix layer(MATRIX_SIZE, MATRIX_SIZE);
+    // A few horizontal strokes, like text
+    for (size_t r = 8; r < 16; r += 2)
+        for (size_t c = 4; c < 60; c++)
+            layer.at(r, c) = 0xFFFFFF;
+    PixelMask mask(layer);
+    cout << "  Memory: " << (layer.size() * sizeof(Pixel)) << " bytes vs "
+         << (mask.row_count() * mask.wordsPerRow() * 4) << " bytes" << endl;
+
+    // Note: one frame per run
+    double baseline = items_per_second(
+        1,
+        [&]()
+        {
+            for (size_t i = 0; i < layer.size(); i++)
+                if (layer[i] != Pixel())
+                    pixels[i] = 0xFF0000;
+            keep(pixels[0].red);
+        });
+    report("PixelMatrix layer", baseline);
+
+    double rate = items_per_second(
+        1,
+        [&]()
+        {
+            mask.tint(pixels, 0xFF0000);
+            keep(pixels[0].red);
+        });
+    report("PixelMask::tint()", rate, baseline);
+}
+
+void benchmark2()
+{
+    cout << "- Scroll left (" << MATRIX_SIZE << "x" << MATRIX_SIZE
+         << " pixels) -" << endl;
+    PixelMatrix layer(MATRIX_SIZE, MATRIX_SIZE);
+    layer.fillRainbow(0, 65536 / layer.size());
+    PixelMask mask(layer);
+
+    double baseline = items_per_second(
+        1,
+        [&]()
+        {
+            layer.scroll(ScrollDirection::left, 1, layer.bounds());
+            keep(layer[0].red);
+        });
+    report("PixelMatrix::scroll()", baseline);
+
+    double rate = items_per_second(
+        1,
+        [&]()
+        {
+            mask.scroll(ScrollDirection::left, 1);
+            keep(mask(0, 0));
+        });
+    report("PixelMask::scroll()", rate, baseline);
+}
+
+//-------------------------------------------------------------------
+// MAIN
+//-------------------------------------------------------------------
+
+int main()
+{
+    benchmark1();
+    benchmark2();
+    return 0;
+}
@@ -0,0 +1,149 @@
+/**
+ * @file MatrixAccessBenchmark.cpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Benchmark of checked versus unchecked pixel access in matrices
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 license
+ */
+
+//-------------------------------------------------------------------
+// Imports
+//-------------------------------------------------------------------
+
+#include "PixelVector.hpp"
+#include "Benchmark.hpp"
+
+using namespace std;
+
+//-------------------------------------------------------------------
+// Globals
+//-------------------------------------------------------------------
+
+#define MATRIX_SIZE 64
+
+//-------------------------------------------------------------------
+// Benchmarks
+//-------------------------------------------------------------------
+
+void benchmark1()
+{
+    cout << "- Chessboard pattern ("
+         << MATRIX_SIZE << "x" << MATRIX_SIZE << " pixels) -" << endl;
+    PixelMatrix pixels(MATRIX_SIZE, MATRIX_SIZE);
+
+    double baseline = items_per_second(
+        pixels.size(),
+        [&pixels]()
+        {
+            for (size_t row = 0; row < pixels.row_count(); row++)
+                for (size_t col = 0; col < pixels.column_count(); col++)
+                    pixels.at(row, col) = ((row ^ col) & 1) ? 0xFFFFFF : 0;
+            keep(pixels.at(1, 1).red);
+        });
+    report("at()", baseline);
+
+    double rate = items_per_second(
+        pixels.size(),
+        [&pixels]()
+        {
+            for (size_t row = 0; row < pixels.row_count(); row++)
+                for (size_t col = 0; col < pixels.column_count(); col++)
+                    pixels(row, col) = ((row ^ col) & 1) ? 0xFFFFFF : 0;
+            keep(pixels.at(1, 1).red);
+        });
+    report("operator()", rate, baseline);
+
+    rate = items_per_second(
+        pixels.size(),
+        [&pixels]()
+        {
+            for (size_t row = 0; row < pixels.row_count(); row++)
+            {
+                PixelSpan span = pixels.row(row);
+                for (size_t col = 0; col < span.size(); col++)
+                    span[col] = ((row ^ col) & 1) ? 0xFFFFFF : 0;
+            }
+            keep(pixels.at(1, 1).red);
+        });
+    report("row()", rate, baseline);
+
+    rate = items_per_second(
+        pixels.size(),
+        [&pixels]()
+        {
+            pixels.forEach(
+                [](size_t row, size_t col, Pixel &pixel)
+                { pixel = ((row ^ col) & 1) ? 0xFFFFFF : 0; });
+            keep(pixels.at(1, 1).red);
+        });
+    report("forEach()", rate, baseline);
+}
+
+void benchmark2()
+{
+    cout << "- Gradient pattern ("
+         << MATRIX_SIZE << "x" << MATRIX_SIZE << " pixels) -" << endl;
+    PixelMatrix pixels(MATRIX_SIZE, MATRIX_SIZE);
+
+    double baseline = items_per_second(
+        pixels.size(),
+        [&pixels]()
+        {
+            for (size_t row = 0; row < pixels.row_count(); row++)
+                for (size_t col = 0; col < pixels.column_count(); col++)
+                {
+                    pixels.at(row, col).red = row * 4;
+                    pixels.at(row, col).green = col * 4;
+                    pixels.at(row, col).blue = 0;
+                }
+            keep(pixels.at(1, 1).red);
+        });
+    report("at()", baseline);
+
+    double rate = items_per_second(
+        pixels.size(),
+        [&pixels]()
+        {
+            for (size_t row = 0; row < pixels.row_count(); row++)
+            {
+                PixelSpan span = pixels.row(row);
+                for (size_t col = 0; col < span.size(); col++)
+                {
+                    span[col].red = row * 4;
+                    span[col].green = col * 4;
+                    span[col].blue = 0;
+                }
+            }
+            keep(pixels.at(1, 1).red);
+        });
+    report("row()", rate, baseline);
+
+    rate = items_per_second(
+        pixels.size(),
+        [&pixels]()
+        {
+            pixels.forEach(
+                [](size_t row, size_t col, Pixel &pixel)
+                {
+                    pixel.red = row * 4;
+                    pixel.green = col * 4;
+                    pixel.blue = 0;
+                });
+            keep(pixels.at(1, 1).red);
+        });
+    report("forEach()", rate, baseline);
+}
+
+//-------------------------------------------------------------------
+// MAIN
+//-------------------------------------------------------------------
+
+int main()
+{
+    benchmark1();
+    benchmark2();
+    return 0;
+}
@@ -0,0 +1,123 @@
+/**
+ * @file MirrorBenchmark.cpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Benchmark of full rendering versus rendering and mirroring
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 license
+ */
+
+//-------------------------------------------------------------------
+// Imports
+//-------------------------------------------------------------------
+
+#include "PixelVector.hpp"
+#include "Benchmark.hpp"
+
+using namespace std;
+
+//-------------------------------------------------------------------
+// Globals
+//-------------------------------------------------------------------
+
+#define MATRIX_SIZE 64
+
+//-------------------------------------------------------------------
+// Auxiliary
+//-------------------------------------------------------------------
+
+// Radial effect (symmetric in all directions)
+void render(PixelMatrix &pixels, const PixelRect &area, uint16_t phase)
+{
+    for (size_t r = area.row; r < area.row + area.row_count; r++)
+    {
+        PixelSpan row = pixels.row(r);
+        int dr = (2 * static_cast<int>(r)) - (MATRIX_SIZE - 1);
+        for (size_t c = area.column; c < area.column + area.column_count; c++)
+        {
+            int dc = (2 * static_cast<int>(c)) - (MATRIX_SIZE - 1);
+            uint16_t hue = ((dr * dr) + (dc * dc)) * 4 + phase;
+            row[c].hsl16(hue, 255, 128);
+        }
+    }
+}
+
+// Radial effect (top-left octant only)
+void render_octant(PixelMatrix &pixels, const PixelRect &area, uint16_t phase)
+{
+    for (size_t r = area.row; r < area.row + area.row_count; r++)
+    {
+        PixelSpan row = pixels.row(r);
+        int dr = (2 * static_cast<int>(r)) - (MATRIX_SIZE - 1);
+        for (size_t c = r; c < area.column + area.column_count; c++)
+        {
+            int dc = (2 * static_cast<int>(c)) - (MATRIX_SIZE - 1);
+            uint16_t hue = ((dr * dr) + (dc * dc)) * 4 + phase;
+            row[c].hsl16(hue, 255, 128);
+        }
+    }
+}
+
+//-------------------------------------------------------------------
+// Benchmarks
+//-------------------------------------------------------------------
+
+void benchmark1()
+{
+    cout << "- Radial effect (" << MATRIX_SIZE << "x" << MATRIX_SIZE
+         << " pixels) -" << endl;
+    PixelMatrix pixels(MATRIX_SIZE, MATRIX_SIZE);
+    uint16_t phase = 0;
+
+    // Note: one frame per run
+    double baseline = items_per_second(
+        1,
+        [&]()
+        {
+            render(pixels, pixels.bounds(), phase += 256);
+            keep(pixels.at(0, 0).red);
+        });
+    report("Full frame", baseline);
+
+    double rate = items_per_second(
+        1,
+        [&]()
+        {
+            render(pixels, pixels.mirrorArea(Symmetry::horizontal), phase);
+            pixels.mirror(Symmetry::horizontal);
+            keep(pixels.at(0, 0).red);
+        });
+    report("Half frame + mirror()", rate, baseline);
+
+    rate = items_per_second(
+        1,
+        [&]()
+        {
+            render(pixels, pixels.mirrorArea(Symmetry::quadrant), phase);
+            pixels.mirror(Symmetry::quadrant);
+            keep(pixels.at(0, 0).red);
+        });
+    report("Quarter frame + mirror()", rate, baseline);
+
+    rate = items_per_second(
+        1,
+        [&]()
+        {
+            render_octant(pixels, pixels.mirrorArea(Symmetry::octant), phase);
+            pixels.mirror(Symmetry::octant);
+            keep(pixels.at(0, 0).red);
+        });
+    report("Eighth of frame + mirror()", rate, baseline);
+}
+
+//-------------------------------------------------------------------
+// MAIN
+//-------------------------------------------------------------------
+
+int main()
+{
+    benchmark1();
+    return 0;
+}
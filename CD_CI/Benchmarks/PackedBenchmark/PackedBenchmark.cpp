@@ -0,0 +1,144 @@
+/**
+ * @file PackedBenchmark.cpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Benchmark of bulk conversions from/to packed RGB and RGBX
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 license
+ */
+
+//-------------------------------------------------------------------
+// Imports
+//-------------------------------------------------------------------
+
+#include "PixelVector.hpp"
+#include "Benchmark.hpp"
+#include <vector>
+
+using namespace std;
+
+//-------------------------------------------------------------------
+// Globals
+//-------------------------------------------------------------------
+
+#define PIXEL_COUNT 1024
+
+//-------------------------------------------------------------------
+// Benchmarks
+//-------------------------------------------------------------------
+
+void benchmark1()
+{
+    cout << "- Packed RGB (" << PIXEL_COUNT << " pixels) -" << endl;
+    vector<uint32_t> packed(PIXEL_COUNT);
+    for (size_t i = 0; i < PIXEL_COUNT; i++)
+        packed[i] = (i * 0x010203) & 0xFFFFFF;
+    PixelVector pixels(PIXEL_COUNT);
+
+    double baseline = items_per_second(
+        PIXEL_COUNT,
+        [&]()
+        {
+            for (size_t i = 0; i < pixels.size(); i++)
+                pixels[i] = packed[i];
+            keep(pixels[PIXEL_COUNT / 2].red);
+        });
+    report("Pixel::operator=() loop", baseline);
+
+    double rate = items_per_second(
+        PIXEL_COUNT,
+        [&]()
+        {
+            pixels.assignPacked(packed.data(), packed.size());
+            keep(pixels[PIXEL_COUNT / 2].red);
+        });
+    report("PixelVector::assignPacked()", rate, baseline);
+
+    baseline = items_per_second(
+        PIXEL_COUNT,
+        [&]()
+        {
+            for (size_t i = 0; i < pixels.size(); i++)
+                packed[i] = pixels[i];
+            keep(packed[PIXEL_COUNT / 2]);
+        });
+    report("Pixel::operator uint32_t() loop", baseline);
+
+    rate = items_per_second(
+        PIXEL_COUNT,
+        [&]()
+        {
+            pixels.exportPacked(packed.data());
+            keep(packed[PIXEL_COUNT / 2]);
+        });
+    report("PixelVector::exportPacked()", rate, baseline);
+}
+
+void benchmark2()
+{
+    cout << "- RGBX (" << PIXEL_COUNT << " pixels) -" << endl;
+    vector<uint8_t> rgbx(4 * PIXEL_COUNT);
+    for (size_t i = 0; i < rgbx.size(); i++)
+        rgbx[i] = i;
+    PixelVector pixels(PIXEL_COUNT);
+
+    double baseline = items_per_second(
+        PIXEL_COUNT,
+        [&]()
+        {
+            for (size_t i = 0; i < pixels.size(); i++)
+            {
+                pixels[i].red = rgbx[4 * i];
+                pixels[i].green = rgbx[4 * i + 1];
+                pixels[i].blue = rgbx[4 * i + 2];
+            }
+            keep(pixels[PIXEL_COUNT / 2].red);
+        });
+    report("Per-pixel loop", baseline);
+
+    double rate = items_per_second(
+        PIXEL_COUNT,
+        [&]()
+        {
+            pixels.assignRGBX(rgbx.data(), PIXEL_COUNT);
+            keep(pixels[PIXEL_COUNT / 2].red);
+        });
+    report("PixelVector::assignRGBX()", rate, baseline);
+
+    baseline = items_per_second(
+        PIXEL_COUNT,
+        [&]()
+        {
+            for (size_t i = 0; i < pixels.size(); i++)
+            {
+                rgbx[4 * i] = pixels[i].red;
+                rgbx[4 * i + 1] = pixels[i].green;
+                rgbx[4 * i + 2] = pixels[i].blue;
+                rgbx[4 * i + 3] = 0;
+            }
+            keep(rgbx[PIXEL_COUNT / 2]);
+        });
+    report("Per-pixel loop", baseline);
+
+    rate = items_per_second(
+        PIXEL_COUNT,
+        [&]()
+        {
+            pixels.exportRGBX(rgbx.data());
+            keep(rgbx[PIXEL_COUNT / 2]);
+        });
+    report("PixelVector::exportRGBX()", rate, baseline);
+}
+
+//-------------------------------------------------------------------
+// MAIN
+//-------------------------------------------------------------------
+
+int main()
+{
+    benchmark1();
+    benchmark2();
+    return 0;
+}
@@ -0,0 +1,83 @@
+/**
+ * @file PaletteBenchmark.cpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Benchmark of color cycling with and without a palette
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 license
+ */
+
+//-------------------------------------------------------------------
+// Imports
+//-------------------------------------------------------------------
+
+#include "PaletteVector.hpp"
+#include "Benchmark.hpp"
+
+using namespace std;
+
+//-------------------------------------------------------------------
+// Globals
+//-------------------------------------------------------------------
+
+#define PIXEL_COUNT 10000
+
+//-------------------------------------------------------------------
+// Benchmarks
+//-------------------------------------------------------------------
+
+void benchmark1()
+{
+    cout << "- Color cycling (" << PIXEL_COUNT << " pixels) -" << endl;
+    PixelVector colors(256);
+    colors.fillRainbow(0, 256);
+    PaletteVector indexed(PIXEL_COUNT);
+    indexed.palette(colors);
+    for (size_t i = 0; i < indexed.size(); i++)
+        indexed[i] = i;
+    PixelVector pixels(PIXEL_COUNT);
+    uint8_t phase = 0;
+
+    // Note: one frame per run
+    double baseline = items_per_second(
+        1,
+        [&]()
+        {
+            phase++;
+            for (size_t i = 0; i < pixels.size(); i++)
+                pixels[i] = colors[static_cast<uint8_t>(i + phase)];
+            keep(pixels[0].red);
+        });
+    report("Recolor a PixelVector", baseline);
+
+    double rate = items_per_second(
+        1,
+        [&]()
+        {
+            indexed.rotatePalette(1);
+            keep(indexed.color(0).red);
+        });
+    report("PaletteVector::rotatePalette()", rate, baseline);
+
+    rate = items_per_second(
+        1,
+        [&]()
+        {
+            indexed.rotatePalette(1);
+            indexed.toPixels(pixels);
+            keep(pixels[0].red);
+        });
+    report("rotatePalette() + toPixels()", rate, baseline);
+}
+
+//-------------------------------------------------------------------
+// MAIN
+//-------------------------------------------------------------------
+
+int main()
+{
+    benchmark1();
+    return 0;
+}
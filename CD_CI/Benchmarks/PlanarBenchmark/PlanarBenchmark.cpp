@@ -0,0 +1,219 @@
+/**
+ * @file PlanarBenchmark.cpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Benchmark of per-channel math on interleaved and planar pixels
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 license
+ */
+
+//-------------------------------------------------------------------
+// Imports
+//-------------------------------------------------------------------
+
+#include "PlanarPixelVector.hpp"
+#include "Benchmark.hpp"
+
+using namespace std;
+
+//-------------------------------------------------------------------
+// Globals
+//-------------------------------------------------------------------
+
+#define PIXEL_COUNT 1024
+
+//-------------------------------------------------------------------
+// Benchmarks
+//-------------------------------------------------------------------
+
+void benchmark1()
+{
+    cout << "- Scale (" << PIXEL_COUNT << " pixels) -" << endl;
+    PixelVector pixels(PIXEL_COUNT, 0xFF8040);
+    PlanarPixelVector planar(pixels);
+
+    double baseline = items_per_second(
+        PIXEL_COUNT,
+        [&pixels]()
+        {
+            for (size_t i = 0; i < pixels.size(); i++)
+            {
+                pixels[i].red = (pixels[i].red * 251) >> 8;
+                pixels[i].green = (pixels[i].green * 251) >> 8;
+                pixels[i].blue = (pixels[i].blue * 251) >> 8;
+            }
+            keep(pixels[PIXEL_COUNT / 2].red);
+        });
+    report("Per-pixel loop", baseline);
+
+    double rate = items_per_second(
+        PIXEL_COUNT,
+        [&pixels]()
+        {
+            pixels.scale(250);
+            keep(pixels[PIXEL_COUNT / 2].red);
+        });
+    report("PixelVector::scale()", rate, baseline);
+
+    rate = items_per_second(
+        PIXEL_COUNT,
+        [&planar]()
+        {
+            planar.scale(250);
+            keep(planar.red()[PIXEL_COUNT / 2]);
+        });
+    report("PlanarPixelVector::scale()", rate, baseline);
+}
+
+void benchmark2()
+{
+    cout << "- Crossfade (" << PIXEL_COUNT << " pixels) -" << endl;
+    PixelVector from(PIXEL_COUNT, 0xFF8040);
+    PixelVector to(PIXEL_COUNT, 0x2040FF);
+    PixelVector pixels(PIXEL_COUNT);
+    PlanarPixelVector planar_from(from);
+    PlanarPixelVector planar_to(to);
+    PlanarPixelVector planar(PIXEL_COUNT);
+    uint8_t amount = 0;
+
+    double baseline = items_per_second(
+        PIXEL_COUNT,
+        [&]()
+        {
+            amount++;
+            for (size_t i = 0; i < pixels.size(); i++)
+            {
+                pixels[i] = from[i];
+                pixels[i].blend(to[i], amount);
+            }
+            keep(pixels[PIXEL_COUNT / 2].red);
+        });
+    report("Pixel::blend() loop", baseline);
+
+    double rate = items_per_second(
+        PIXEL_COUNT,
+        [&]()
+        {
+            amount++;
+            pixels.crossfade(from, to, amount);
+            keep(pixels[PIXEL_COUNT / 2].red);
+        });
+    report("PixelVector::crossfade()", rate, baseline);
+
+    rate = items_per_second(
+        PIXEL_COUNT,
+        [&]()
+        {
+            amount++;
+            planar.crossfade(planar_from, planar_to, amount);
+            keep(planar.red()[PIXEL_COUNT / 2]);
+        });
+    report("PlanarPixelVector::crossfade()", rate, baseline);
+}
+
+void benchmark3()
+{
+    cout << "- Additive blend (" << PIXEL_COUNT << " pixels) -" << endl;
+    PixelVector pixels(PIXEL_COUNT, 0x102030);
+    PixelVector other(PIXEL_COUNT, 0x010101);
+    PlanarPixelVector planar(pixels);
+    PlanarPixelVector planar_other(other);
+
+    double baseline = items_per_second(
+        PIXEL_COUNT,
+        [&]()
+        {
+            pixels.blendAdd(other);
+            keep(pixels[PIXEL_COUNT / 2].red);
+        });
+    report("PixelVector::blendAdd()", baseline);
+
+    double rate = items_per_second(
+        PIXEL_COUNT,
+        [&]()
+        {
+            planar.blendAdd(planar_other);
+            keep(planar.red()[PIXEL_COUNT / 2]);
+        });
+    report("PlanarPixelVector::blendAdd()", rate, baseline);
+}
+
+void benchmark4()
+{
+    cout << "- Color grading (" << PIXEL_COUNT << " pixels) -" << endl;
+    PixelVector pixels(PIXEL_COUNT, 0xFF8040);
+    PlanarPixelVector planar(pixels);
+
+    double baseline = items_per_second(
+        PIXEL_COUNT,
+        [&pixels]()
+        {
+            for (size_t i = 0; i < pixels.size(); i++)
+            {
+                pixels[i].red = (pixels[i].red * 256) >> 8;
+                pixels[i].green = (pixels[i].green * 231) >> 8;
+                pixels[i].blue = (pixels[i].blue * 201) >> 8;
+            }
+            keep(pixels[PIXEL_COUNT / 2].red);
+        });
+    report("Per-pixel loop", baseline);
+
+    double rate = items_per_second(
+        PIXEL_COUNT,
+        [&planar]()
+        {
+            planar.scale(255, 230, 200);
+            keep(planar.red()[PIXEL_COUNT / 2]);
+        });
+    report("PlanarPixelVector::scale(r,g,b)", rate, baseline);
+}
+
+void benchmark5()
+{
+    cout << "- Conversion (" << PIXEL_COUNT << " pixels) -" << endl;
+    PixelVector pixels(PIXEL_COUNT, 0xFF8040);
+    PlanarPixelVector planar(PIXEL_COUNT);
+
+    double baseline = items_per_second(
+        PIXEL_COUNT,
+        [&]()
+        {
+            PixelVector copy = pixels;
+            keep(copy[PIXEL_COUNT / 2].red);
+        });
+    report("Copy a PixelVector", baseline);
+
+    double rate = items_per_second(
+        PIXEL_COUNT,
+        [&]()
+        {
+            planar.assign(pixels);
+            keep(planar.red()[PIXEL_COUNT / 2]);
+        });
+    report("PlanarPixelVector::assign()", rate, baseline);
+
+    rate = items_per_second(
+        PIXEL_COUNT,
+        [&]()
+        {
+            planar.toPixels(pixels);
+            keep(pixels[PIXEL_COUNT / 2].red);
+        });
+    report("PlanarPixelVector::toPixels()", rate, baseline);
+}
+
+//-------------------------------------------------------------------
+// MAIN
+//-------------------------------------------------------------------
+
+int main()
+{
+    benchmark1();
+    benchmark2();
+    benchmark3();
+    benchmark4();
+    benchmark5();
+    return 0;
+}
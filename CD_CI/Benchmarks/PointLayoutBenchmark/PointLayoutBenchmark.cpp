@@ -0,0 +1,93 @@
+/**
+ * @file PointLayoutBenchmark.cpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Benchmark of spatial queries in arbitrary LED layouts
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 license
+ */
+
+//-------------------------------------------------------------------
+// Imports
+//-------------------------------------------------------------------
+
+#include "PointLayout.hpp"
+#include "Benchmark.hpp"
+#include <vector>
+
+using namespace std;
+
+//-------------------------------------------------------------------
+// Benchmarks
+//-------------------------------------------------------------------
+
+void benchmark1()
+{
+    // Note: 1024 LEDs in a spiral-like scatter, 2000x2000 units wide
+    const size_t count = 1024;
+    vector<LedPoint> points(count);
+    uint32_t seed = 12345;
+    for (LedPoint &p : points)
+    {
+        seed = (seed * 1103515245) + 12345;
+        p.x = (seed >> 8) % 2000;
+        seed = (seed * 1103515245) + 12345;
+        p.y = (seed >> 8) % 2000;
+    }
+    PointLayout layout(points.data(), count);
+    const uint32_t distance = 150;
+
+    cout << "- LEDs within a radius (" << count << " LEDs) -" << endl;
+
+    // Note: one query per item, moving around the layout
+    size_t query = 0;
+    double baseline = items_per_second(
+        1,
+        [&]()
+        {
+            int32_t x = (query * 37) % 2000;
+            int32_t y = (query * 91) % 2000;
+            query++;
+            int64_t max_squared = (int64_t)distance * distance;
+            size_t found = 0;
+            for (size_t i = 0; i < count; i++)
+            {
+                int64_t dx = points[i].x - x;
+                int64_t dy = points[i].y - y;
+                if (((dx * dx) + (dy * dy)) <= max_squared)
+                    found++;
+            }
+            keep(found);
+        });
+    report("Brute force (queries/s)", baseline);
+
+    query = 0;
+    double rate = items_per_second(
+        1,
+        [&]()
+        {
+            int32_t x = (query * 37) % 2000;
+            int32_t y = (query * 91) % 2000;
+            query++;
+            size_t found = 0;
+            layout.forEachWithin(
+                x,
+                y,
+                distance,
+                [&found](size_t) { found++; });
+            keep(found);
+        });
+    report("PointLayout::forEachWithin() (queries/s)", rate, baseline);
+}
+
+//-------------------------------------------------------------------
+// MAIN
+//-------------------------------------------------------------------
+
+int main()
+{
+    benchmark1();
+    return 0;
+}
@@ -0,0 +1,158 @@
+/**
+ * @file ResampleBenchmark.cpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Benchmark of floating point versus fixed-point resampling
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 license
+ */
+
+//-------------------------------------------------------------------
+// Imports
+//-------------------------------------------------------------------
+
+#include "PixelVector.hpp"
+#include "Benchmark.hpp"
+
+using namespace std;
+
+//-------------------------------------------------------------------
+// Globals
+//-------------------------------------------------------------------
+
+#define LARGE_SIZE 64
+#define SMALL_SIZE 32
+
+//-------------------------------------------------------------------
+// Auxiliary
+//-------------------------------------------------------------------
+
+uint8_t lerp(float a, float b, float t)
+{
+    return static_cast<uint8_t>(a + ((b - a) * t) + 0.5f);
+}
+
+//-------------------------------------------------------------------
+// Benchmarks
+//-------------------------------------------------------------------
+
+void benchmark1()
+{
+    cout << "- Downscale " << LARGE_SIZE << "x" << LARGE_SIZE
+         << " to " << SMALL_SIZE << "x" << SMALL_SIZE << " pixels -" << endl;
+    PixelMatrix source(LARGE_SIZE, LARGE_SIZE);
+    PixelMatrix target(SMALL_SIZE, SMALL_SIZE);
+    source.fillRainbow(0, 65536 / source.size());
+
+    // Note: one frame per run
+    double baseline = items_per_second(
+        1,
+        [&]()
+        {
+            float scale = static_cast<float>(LARGE_SIZE) / SMALL_SIZE;
+            size_t n = static_cast<size_t>(scale);
+            for (size_t r = 0; r < SMALL_SIZE; r++)
+                for (size_t c = 0; c < SMALL_SIZE; c++)
+                {
+                    float red = 0, green = 0, blue = 0;
+                    for (size_t i = 0; i < n; i++)
+                        for (size_t j = 0; j < n; j++)
+                        {
+                            const Pixel &pixel = source.at(
+                                static_cast<size_t>(r * scale) + i,
+                                static_cast<size_t>(c * scale) + j);
+                            red += pixel.red;
+                            green += pixel.green;
+                            blue += pixel.blue;
+                        }
+                    Pixel &pixel = target.at(r, c);
+                    pixel.red = red / (n * n);
+                    pixel.green = green / (n * n);
+                    pixel.blue = blue / (n * n);
+                }
+            keep(target.at(0, 0).red);
+        });
+    report("Floating point (at())", baseline);
+
+    double rate = items_per_second(
+        1,
+        [&]()
+        {
+            target.resample(source, ResampleFilter::box);
+            keep(target.at(0, 0).red);
+        });
+    report("resample() (box)", rate, baseline);
+}
+
+void benchmark2()
+{
+    cout << "- Upscale " << SMALL_SIZE << "x" << SMALL_SIZE
+         << " to " << LARGE_SIZE << "x" << LARGE_SIZE << " pixels -" << endl;
+    PixelMatrix source(SMALL_SIZE, SMALL_SIZE);
+    PixelMatrix target(LARGE_SIZE, LARGE_SIZE);
+    source.fillRainbow(0, 65536 / source.size());
+
+    double baseline = items_per_second(
+        1,
+        [&]()
+        {
+            float scale = static_cast<float>(SMALL_SIZE) / LARGE_SIZE;
+            for (size_t r = 0; r < LARGE_SIZE; r++)
+                for (size_t c = 0; c < LARGE_SIZE; c++)
+                {
+                    float y = max(0.0f, ((r + 0.5f) * scale) - 0.5f);
+                    float x = max(0.0f, ((c + 0.5f) * scale) - 0.5f);
+                    size_t r0 = y, c0 = x;
+                    size_t r1 = min(r0 + 1, size_t(SMALL_SIZE - 1));
+                    size_t c1 = min(c0 + 1, size_t(SMALL_SIZE - 1));
+                    float ty = y - r0, tx = x - c0;
+                    const Pixel &p00 = source.at(r0, c0);
+                    const Pixel &p01 = source.at(r0, c1);
+                    const Pixel &p10 = source.at(r1, c0);
+                    const Pixel &p11 = source.at(r1, c1);
+                    Pixel &pixel = target.at(r, c);
+                    pixel.red = lerp(
+                        lerp(p00.red, p01.red, tx),
+                        lerp(p10.red, p11.red, tx), ty);
+                    pixel.green = lerp(
+                        lerp(p00.green, p01.green, tx),
+                        lerp(p10.green, p11.green, tx), ty);
+                    pixel.blue = lerp(
+                        lerp(p00.blue, p01.blue, tx),
+                        lerp(p10.blue, p11.blue, tx), ty);
+                }
+            keep(target.at(0, 0).red);
+        });
+    report("Floating point (at())", baseline);
+
+    double rate = items_per_second(
+        1,
+        [&]()
+        {
+            target.resample(source, ResampleFilter::bilinear);
+            keep(target.at(0, 0).red);
+        });
+    report("resample() (bilinear)", rate, baseline);
+
+    rate = items_per_second(
+        1,
+        [&]()
+        {
+            target.resample(source, ResampleFilter::nearest);
+            keep(target.at(0, 0).red);
+        });
+    report("resample() (nearest)", rate, baseline);
+}
+
+//-------------------------------------------------------------------
+// MAIN
+//-------------------------------------------------------------------
+
+int main()
+{
+    benchmark1();
+    benchmark2();
+    return 0;
+}
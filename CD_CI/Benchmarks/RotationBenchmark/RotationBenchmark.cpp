@@ -0,0 +1,97 @@
+/**
+ * @file RotationBenchmark.cpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Benchmark of physical shifts versus virtual rotations
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 license
+ */
+
+//-------------------------------------------------------------------
+// Imports
+//-------------------------------------------------------------------
+
+#include "RotatedPixelVector.hpp"
+#include "Benchmark.hpp"
+
+using namespace std;
+
+//-------------------------------------------------------------------
+// Globals
+//-------------------------------------------------------------------
+
+#define PIXEL_COUNT 1024
+#define MATRIX_SIZE 32
+
+//-------------------------------------------------------------------
+// Benchmarks
+//-------------------------------------------------------------------
+
+void benchmark1()
+{
+    cout << "- Marquee (" << PIXEL_COUNT << " pixels) -" << endl;
+    PixelVector pixels(PIXEL_COUNT);
+    pixels.fillRainbow(0, 65536 / PIXEL_COUNT);
+
+    // Note: one frame per run
+    double baseline = items_per_second(
+        1,
+        [&pixels]()
+        {
+            pixels >> 1;
+            keep(pixels[0].red);
+        });
+    report("operator>>()", baseline);
+
+    RotatedPixelVector view(pixels);
+    double rate = items_per_second(
+        1,
+        [&view]()
+        {
+            view.rotate(1);
+            keep(view[0].red);
+        });
+    report("rotate()", rate, baseline);
+}
+
+void benchmark2()
+{
+    cout << "- Matrix scroll ("
+         << MATRIX_SIZE << "x" << MATRIX_SIZE << " pixels) -" << endl;
+    PixelMatrix pixels(MATRIX_SIZE, MATRIX_SIZE);
+    pixels.fillRainbow(0, 65536 / pixels.size());
+
+    double baseline = items_per_second(
+        1,
+        [&pixels]()
+        {
+            pixels << 1;
+            pixels.scroll_up(1);
+            keep(pixels.at(0, 0).red);
+        });
+    report("operator<<() and scroll_up()", baseline);
+
+    RotatedPixelVector view(pixels);
+    double rate = items_per_second(
+        1,
+        [&view]()
+        {
+            view.rotate_left(1);
+            view.rotate_up(1);
+            keep(view(0, 0).red);
+        });
+    report("rotate_left() and rotate_up()", rate, baseline);
+}
+
+//-------------------------------------------------------------------
+// MAIN
+//-------------------------------------------------------------------
+
+int main()
+{
+    benchmark1();
+    benchmark2();
+    return 0;
+}
@@ -0,0 +1,141 @@
+/**
+ * @file ScrollBenchmark.cpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Benchmark of element-wise shifts versus block-move scrolls
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 license
+ */
+
+//-------------------------------------------------------------------
+// Imports
+//-------------------------------------------------------------------
+
+#include "PixelVector.hpp"
+#include "Benchmark.hpp"
+
+using namespace std;
+
+//-------------------------------------------------------------------
+// Globals
+//-------------------------------------------------------------------
+
+#define MATRIX_SIZE 64
+
+//-------------------------------------------------------------------
+// Benchmarks
+//-------------------------------------------------------------------
+
+void benchmark1()
+{
+    cout << "- Scroll up ("
+         << MATRIX_SIZE << "x" << MATRIX_SIZE << " pixels) -" << endl;
+    PixelMatrix pixels(MATRIX_SIZE, MATRIX_SIZE);
+    pixels.fillRainbow(0, 65536 / pixels.size());
+
+    // Note: one frame per run
+    double baseline = items_per_second(
+        1,
+        [&pixels]()
+        {
+            pixels.shift(pixels.size() - 1, 0, MATRIX_SIZE);
+            keep(pixels.at(0, 0).red);
+        });
+    report("shift()", baseline);
+
+    double rate = items_per_second(
+        1,
+        [&pixels]()
+        {
+            pixels.scroll(ScrollDirection::up, 1, pixels.bounds());
+            keep(pixels.at(0, 0).red);
+        });
+    report("scroll() (wrap)", rate, baseline);
+
+    rate = items_per_second(
+        1,
+        [&pixels]()
+        {
+            pixels.scroll(ScrollDirection::up, 1, pixels.bounds(), 0);
+            keep(pixels.at(0, 0).red);
+        });
+    report("scroll() (fill)", rate, baseline);
+}
+
+void benchmark2()
+{
+    cout << "- Scroll left ("
+         << MATRIX_SIZE << "x" << MATRIX_SIZE << " pixels) -" << endl;
+    PixelMatrix pixels(MATRIX_SIZE, MATRIX_SIZE);
+    pixels.fillRainbow(0, 65536 / pixels.size());
+
+    double baseline = items_per_second(
+        1,
+        [&pixels]()
+        {
+            for (size_t row = 0; row < MATRIX_SIZE; row++)
+                pixels.shift(
+                    (row * MATRIX_SIZE) + MATRIX_SIZE - 1,
+                    row * MATRIX_SIZE,
+                    1);
+            keep(pixels.at(0, 0).red);
+        });
+    report("shift() on each row", baseline);
+
+    double rate = items_per_second(
+        1,
+        [&pixels]()
+        {
+            pixels.scroll(ScrollDirection::left, 1, pixels.bounds());
+            keep(pixels.at(0, 0).red);
+        });
+    report("scroll() (wrap)", rate, baseline);
+}
+
+void benchmark3()
+{
+    cout << "- Scroll a " << (MATRIX_SIZE / 2) << "x" << (MATRIX_SIZE / 2)
+         << " area down (" << MATRIX_SIZE << "x" << MATRIX_SIZE
+         << " pixels) -" << endl;
+    PixelMatrix pixels(MATRIX_SIZE, MATRIX_SIZE);
+    PixelRect area{8, 8, MATRIX_SIZE / 2, MATRIX_SIZE / 2};
+    pixels.fillRainbow(0, 65536 / pixels.size());
+
+    double baseline = items_per_second(
+        1,
+        [&pixels, &area]()
+        {
+            // Element by element, bottom-up
+            for (size_t row = area.row_count - 1; row > 0; row--)
+                for (size_t col = 0; col < area.column_count; col++)
+                    pixels.at(area.row + row, area.column + col) =
+                        pixels.at(area.row + row - 1, area.column + col);
+            for (size_t col = 0; col < area.column_count; col++)
+                pixels.at(area.row, area.column + col) = 0;
+            keep(pixels.at(area.row, area.column).red);
+        });
+    report("Pixel-wise copy", baseline);
+
+    double rate = items_per_second(
+        1,
+        [&pixels, &area]()
+        {
+            pixels.scroll(ScrollDirection::down, 1, area, 0);
+            keep(pixels.at(area.row, area.column).red);
+        });
+    report("scroll() (fill)", rate, baseline);
+}
+
+//-------------------------------------------------------------------
+// MAIN
+//-------------------------------------------------------------------
+
+int main()
+{
+    benchmark1();
+    benchmark2();
+    benchmark3();
+    return 0;
+}
@@ -0,0 +1,79 @@
+/**
+ * @file TickerBenchmark.cpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Benchmark of text re-rendering versus a pre-rasterized ticker
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 license
+ */
+
+//-------------------------------------------------------------------
+// Imports
+//-------------------------------------------------------------------
+
+#include "TextTicker.hpp"
+#include "Benchmark.hpp"
+
+using namespace std;
+
+//-------------------------------------------------------------------
+// Globals
+//-------------------------------------------------------------------
+
+#define MATRIX_ROWS 8
+#define MATRIX_COLUMNS 32
+
+static const char *short_text = "Hello world!";
+static const char *long_text =
+    "The quick brown fox jumps over the lazy dog. "
+    "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG. 0123456789";
+
+//-------------------------------------------------------------------
+// Benchmarks
+//-------------------------------------------------------------------
+
+void benchmark(const char *text)
+{
+    const BitmapFont &font = BitmapFont::standard();
+    cout << "- Ticker frame (" << font.textWidth(text) << " columns of text, "
+         << MATRIX_ROWS << "x" << MATRIX_COLUMNS << " pixels) -" << endl;
+    PixelMatrix pixels(MATRIX_ROWS, MATRIX_COLUMNS);
+    ::std::ptrdiff_t period = font.textWidth(text) + MATRIX_COLUMNS;
+    ::std::ptrdiff_t offset = 0;
+
+    // Note: one frame per run
+    double baseline = items_per_second(
+        1,
+        [&]()
+        {
+            offset = (offset + 1) % period;
+            pixels.fill(0);
+            font.draw(pixels, text, 0, MATRIX_COLUMNS - offset, 0xFFFFFF);
+            keep(pixels.at(0, 0).red);
+        });
+    report("BitmapFont::draw()", baseline);
+
+    TextTicker ticker(text, MATRIX_COLUMNS, font);
+    double rate = items_per_second(
+        1,
+        [&]()
+        {
+            ticker.advance();
+            ticker.draw(pixels, 0, 0xFFFFFF);
+            keep(pixels.at(0, 0).red);
+        });
+    report("TextTicker::draw()", rate, baseline);
+}
+
+//-------------------------------------------------------------------
+// MAIN
+//-------------------------------------------------------------------
+
+int main()
+{
+    benchmark(short_text);
+    benchmark(long_text);
+    return 0;
+}
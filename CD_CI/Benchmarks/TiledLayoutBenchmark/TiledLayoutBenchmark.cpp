@@ -0,0 +1,93 @@
+/**
+ * @file TiledLayoutBenchmark.cpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Benchmark of pixel mapping in tiled LED matrices
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 license
+ */
+
+//-------------------------------------------------------------------
+// Imports
+//-------------------------------------------------------------------
+
+#include "TiledLayout.hpp"
+#include "PixelVector.hpp"
+#include "Benchmark.hpp"
+
+using namespace std;
+
+//-------------------------------------------------------------------
+// Benchmarks
+//-------------------------------------------------------------------
+
+void benchmark1()
+{
+    // Two rows of four 16x16 panels
+    LedMatrixParameters grid{
+        .row_count = 2,
+        .column_count = 4,
+        .first_pixel = LedMatrixFirstPixel::top_left,
+        .arrangement = LedMatrixArrangement::rows,
+        .wiring = LedMatrixWiring::serpentine,
+    };
+    LedMatrixParameters panel{
+        .row_count = 16,
+        .column_count = 16,
+        .first_pixel = LedMatrixFirstPixel::top_left,
+        .arrangement = LedMatrixArrangement::columns,
+        .wiring = LedMatrixWiring::serpentine,
+    };
+    TiledLayout layout(grid, panel);
+    WireMap map = layout.wireMap();
+    PixelMatrix canvas(layout.row_count(), layout.column_count());
+    canvas.fillRainbow(0, 64);
+    size_t count = layout.size();
+
+    cout << "- Read a frame in wire order (" << count << " pixels) -"
+         << endl;
+
+    // Note: this is what the LED strip does while transmitting
+    double baseline = items_per_second(
+        count,
+        [&]()
+        {
+            uint32_t sum = 0;
+            for (size_t i = 0; i < count; i++)
+                sum += canvas[layout.canonicalIndex(i)].red;
+            keep(sum);
+        });
+    report("TiledLayout::canonicalIndex()", baseline);
+
+    double rate = items_per_second(
+        count,
+        [&]()
+        {
+            uint32_t sum = 0;
+            for (size_t i = 0; i < count; i++)
+                sum += canvas[map[i]].red;
+            keep(sum);
+        });
+    report("WireMap", rate, baseline);
+
+    rate = items_per_second(
+        1,
+        [&]()
+        {
+            WireMap rebuilt = layout.wireMap();
+            keep(rebuilt[0]);
+        });
+    report("Build the wire map (maps/s)", rate);
+}
+
+//-------------------------------------------------------------------
+// MAIN
+//-------------------------------------------------------------------
+
+int main()
+{
+    benchmark1();
+    return 0;
+}
@@ -0,0 +1,64 @@
+/**
+ * @file TransposeBenchmark.cpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Benchmark of pixel matrix transposition
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 license
+ */
+
+//-------------------------------------------------------------------
+// Imports
+//-------------------------------------------------------------------
+
+#include "PixelVector.hpp"
+#include "Benchmark.hpp"
+
+using namespace std;
+
+//-------------------------------------------------------------------
+// Benchmarks
+//-------------------------------------------------------------------
+
+void benchmark(size_t rows, size_t columns)
+{
+    PixelMatrix matrix(rows, columns);
+    matrix.fillRainbow(0, 64);
+    PixelMatrix other(columns, rows);
+
+    cout << "- Transpose " << rows << "x" << columns << " -" << endl;
+
+    // Note: column-wise writes miss the cache on every pixel
+    double baseline = items_per_second(
+        matrix.size(),
+        [&]()
+        {
+            for (size_t r = 0; r < rows; r++)
+                for (size_t c = 0; c < columns; c++)
+                    other(c, r) = matrix(r, c);
+            keep(other[1].red);
+        });
+    report("Pixel by pixel (copy)", baseline);
+
+    double rate = items_per_second(
+        matrix.size(),
+        [&]()
+        {
+            matrix.transpose();
+            keep(matrix[1].red);
+        });
+    report("PixelMatrix::transpose()", rate, baseline);
+}
+
+//-------------------------------------------------------------------
+// MAIN
+//-------------------------------------------------------------------
+
+int main()
+{
+    benchmark(256, 256);
+    benchmark(128, 512);
+    return 0;
+}
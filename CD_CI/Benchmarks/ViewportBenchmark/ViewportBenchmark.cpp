@@ -0,0 +1,106 @@
+/**
+ * @file ViewportBenchmark.cpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Benchmark of windows into a large pixel matrix
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 license
+ */
+
+//-------------------------------------------------------------------
+// Imports
+//-------------------------------------------------------------------
+
+#include "PixelViewport.hpp"
+#include "Benchmark.hpp"
+
+using namespace std;
+
+//-------------------------------------------------------------------
+// Benchmarks
+//-------------------------------------------------------------------
+
+void benchmark1()
+{
+    // A 16x64 LED matrix panning over a 64x1024 canvas
+    PixelMatrix canvas(64, 1024);
+    canvas.fillRainbow(0, 64);
+    PixelMatrix window(16, 64);
+    PixelViewport viewport(canvas, 16, 64);
+    size_t count = window.size();
+    size_t frame = 0;
+
+    cout << "- Pan and read a frame (" << count << " pixels) -" << endl;
+
+    // Note: copy the window, then read it in order as the LED strip does
+    double baseline = items_per_second(
+        count,
+        [&]()
+        {
+            size_t row = frame % 48;
+            size_t column = (frame * 3) % 960;
+            frame++;
+            for (size_t r = 0; r < 16; r++)
+                for (size_t c = 0; c < 64; c++)
+                    window(r, c) = canvas(row + r, column + c);
+            uint32_t sum = 0;
+            for (size_t i = 0; i < count; i++)
+                sum += window[i].red;
+            keep(sum);
+        });
+    report("Copy into a PixelMatrix", baseline);
+
+    frame = 0;
+    double rate = items_per_second(
+        count,
+        [&]()
+        {
+            viewport.moveTo(frame % 48, (frame * 3) % 960);
+            frame++;
+            uint32_t sum = 0;
+            for (size_t i = 0; i < count; i++)
+                sum += viewport[i].red;
+            keep(sum);
+        });
+    report("PixelViewport", rate, baseline);
+
+    cout << "- Pan only -" << endl;
+
+    frame = 0;
+    baseline = items_per_second(
+        1,
+        [&]()
+        {
+            size_t row = frame % 48;
+            size_t column = (frame * 3) % 960;
+            frame++;
+            for (size_t r = 0; r < 16; r++)
+                for (size_t c = 0; c < 64; c++)
+                    window(r, c) = canvas(row + r, column + c);
+            keep(window[0].red);
+        });
+    report("Copy into a PixelMatrix (frames/s)", baseline);
+
+    frame = 0;
+    rate = items_per_second(
+        1,
+        [&]()
+        {
+            viewport.moveTo(frame % 48, (frame * 3) % 960);
+            frame++;
+            keep(viewport[0].red);
+        });
+    report("PixelViewport::moveTo() (frames/s)", rate, baseline);
+}
+
+//-------------------------------------------------------------------
+// MAIN
+//-------------------------------------------------------------------
+
+int main()
+{
+    benchmark1();
+    return 0;
+}
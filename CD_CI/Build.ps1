@@ -33,6 +33,7 @@ $_cd_ci_includes_path = Join-Path $RootPath "/CD_CI/include"
 $_compiler_args = @(
     "-fdiagnostics-color=always", # colored output
     "-std=c++17", # C++ standard revision 17
+    "-O2", # Optimize (required for meaningful benchmarks)
     "-iquote",
     $_arduino_includes_path, # Includes path
     "-iquote",
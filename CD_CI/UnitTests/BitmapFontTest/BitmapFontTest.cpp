@@ -0,0 +1,126 @@
+/**
+ * @file BitmapFontTest.cpp
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Test bitmap fonts
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 license
+ */
+
+//-------------------------------------------------------------------
+// Imports
+//-------------------------------------------------------------------
+
+#include "BitmapFont.hpp"
+#include <iostream>
+#include <cassert>
+
+using namespace std;
+
+//-------------------------------------------------------------------
+// Globals
+//-------------------------------------------------------------------
+
+// 3x2 glyph: lit pixels at (0,0), (1,0), (2,0) and (2,1)
+static const uint8_t test_data[] = {0x03, 0x21, 0xF0, 0x21};
+static const BitmapGlyph test_glyphs[] = {{0, 2}, {2, 6}};
+static const BitmapFont test_font(3, 'a', 'b', test_glyphs, test_data, 2);
+
+//-------------------------------------------------------------------
+// Tests
+//-------------------------------------------------------------------
+
+void test1()
+{
+    cout << "- Glyph decoding -" << endl;
+    uint32_t columns[8];
+    assert(test_font.rasterize('a', columns) == 2);
+    assert(columns[0] == 0b111);
+    assert(columns[1] == 0b100);
+    // Split run: 17 unlit pixels, then one lit pixel
+    assert(test_font.rasterize('b', columns) == 6);
+    for (int i = 0; i < 5; i++)
+        assert(columns[i] == 0);
+    assert(columns[5] == 0b100);
+    assert(test_font.rasterize('c', columns) == 0);
+}
+
+void test2()
+{
+    cout << "- Built-in font -" << endl;
+    const BitmapFont &font = BitmapFont::standard();
+    uint32_t columns[8];
+    assert(font.height() == 7);
+    assert(font.rasterize('A', columns) == 5);
+    assert(columns[0] == 0x7E);
+    assert(columns[1] == 0x11);
+    assert(columns[2] == 0x11);
+    assert(columns[3] == 0x11);
+    assert(columns[4] == 0x7E);
+    assert(font.rasterize('!', columns) == 1);
+    assert(columns[0] == 0x5F);
+    assert(font.rasterize('~', columns) == 5);
+    assert(columns[2] == 0x08);
+    assert(font.rasterize(' ', columns) == 3);
+    assert(columns[0] == 0);
+    assert(!font.contains('\n'));
+}
+
+void test3()
+{
+    cout << "- Text width -" << endl;
+    assert(test_font.textWidth("") == 0);
+    assert(test_font.textWidth(nullptr) == 0);
+    assert(test_font.textWidth("a") == 2);
+    assert(test_font.textWidth("ab") == 2 + 2 + 6);
+    assert(test_font.textWidth("a?a") == 2 + 2 + 2);
+    const BitmapFont &font = BitmapFont::standard();
+    assert(font.textWidth("Hi!") == 5 + 1 + 3 + 1 + 1);
+}
+
+void test4()
+{
+    cout << "- Draw text -" << endl;
+    PixelMatrix mtx(3, 8, 9);
+    assert(test_font.draw(mtx, "aa", 0, 1, 1) == 6);
+    assert(mtx.at(0, 0) == 9);
+    assert(mtx.at(0, 1) == 1);
+    assert(mtx.at(1, 1) == 1);
+    assert(mtx.at(2, 2) == 1);
+    assert(mtx.at(1, 2) == 9);
+    assert(mtx.at(0, 3) == 9);
+    assert(mtx.at(0, 5) == 1);
+    assert(mtx.at(2, 6) == 1);
+    // Clipped
+    mtx.fill(9);
+    test_font.draw(mtx, "aa", -2, -4, 1);
+    assert(mtx.at(0, 0) == 1);
+    assert(mtx.at(0, 1) == 1);
+    assert(mtx.at(1, 0) == 9);
+    mtx.fill(9);
+    test_font.draw(mtx, "a", 0, 7, 1);
+    assert(mtx.at(2, 7) == 1);
+    test_font.draw(mtx, "a", 3, 0, 1);
+    test_font.draw(mtx, "a", 0, -2, 1);
+    assert(mtx.at(0, 0) == 9);
+    // Change tracking
+    mtx.trackChanges(true);
+    mtx.markClean();
+    test_font.draw(mtx, "a", 1, 0, 1);
+    assert(!mtx.dirtyRow(0));
+    assert(mtx.dirtyRow(1));
+}
+
+//-------------------------------------------------------------------
+// MAIN
+//-------------------------------------------------------------------
+
+int main()
+{
+    test1();
+    test2();
+    test3();
+    test4();
+    return 0;
+}
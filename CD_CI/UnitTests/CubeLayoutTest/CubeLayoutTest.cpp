@@ -0,0 +1,158 @@
+/**
+ * @file CubeLayoutTest.cpp
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Test LED cubes and pixel volumes
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 license
+ */
+
+//-------------------------------------------------------------------
+// Imports
+//-------------------------------------------------------------------
+
+#include "CubeLayout.hpp"
+#include "PixelVolume.hpp"
+#include <iostream>
+#include <cassert>
+#include <vector>
+
+using namespace std;
+
+//-------------------------------------------------------------------
+// Globals
+//-------------------------------------------------------------------
+
+// Note: 3 layers of 2x3, serpentine within and between layers
+static constexpr LedCubeParameters cube{
+    .layer = {
+        .row_count = 2,
+        .column_count = 3,
+        .first_pixel = LedMatrixFirstPixel::top_left,
+        .arrangement = LedMatrixArrangement::rows,
+        .wiring = LedMatrixWiring::serpentine},
+    .layer_count = 3,
+    .first_layer = LedCubeFirstLayer::bottom,
+    .layer_wiring = LedMatrixWiring::serpentine};
+
+//-------------------------------------------------------------------
+// Tests
+//-------------------------------------------------------------------
+
+void test1()
+{
+    cout << "- Cube parameters -" << endl;
+    static_assert(cube.size() == 18);
+    static_assert(cube.canonicalIndex(0) == 0);
+    static_assert(cube.canonicalIndex(5) == 3);
+    // Note: second layer in reverse order, starting above the last LED
+    static_assert(cube.canonicalIndex(6) == 6 + 3);
+    static_assert(cube.canonicalIndex(11) == 6 + 0);
+    static_assert(cube.canonicalIndex(12) == 12 + 0);
+    size_t x, y, z;
+    cube.indexToCoordinates(8, x, y, z);
+    assert((x == 2) && (y == 1) && (z == 1));
+
+    LedCubeParameters top = cube;
+    top.first_layer = LedCubeFirstLayer::top;
+    top.layer_wiring = LedMatrixWiring::linear;
+    assert(top.canonicalIndex(0) == 12);
+    assert(top.canonicalIndex(6) == 6);
+    assert(top.canonicalIndex(17) == 3);
+}
+
+void test2()
+{
+    cout << "- Wire map -" << endl;
+    CubeLayout layout(cube);
+    assert(layout.layer_count() == 3);
+    assert(layout.size() == 18);
+    assert(layout.layer(1).reversed);
+    WireMap map = layout.wireMap();
+    assert(map.size() == 18);
+    assert((map.row_count == 6) && (map.column_count == 3));
+    vector<bool> seen(18, false);
+    for (size_t i = 0; i < map.size(); i++)
+    {
+        assert(map[i] == cube.canonicalIndex(i));
+        assert(map[i] == layout.canonicalIndex(i));
+        assert(!seen[map[i]]);
+        seen[map[i]] = true;
+    }
+
+    // Per-layer orientation
+    CubeLayout custom(2, 2, 2);
+    LedMatrixParameters rotated{
+        2, 2,
+        LedMatrixFirstPixel::top_right,
+        LedMatrixArrangement::columns,
+        LedMatrixWiring::linear};
+    LedMatrixParameters square = rotated;
+    square.rotate90clockwise();
+    custom.addLayer(1, square);
+    custom.addLayer(0, rotated, true);
+    assert(custom.size() == 8);
+    map = custom.wireMap();
+    for (size_t i = 0; i < 8; i++)
+        assert(map[i] == custom.canonicalIndex(i));
+    assert(map[4] == 2);
+    assert(map[7] == 1);
+
+    // Canvas too large for 16-bit indices
+    CubeLayout huge(2, 256, 256);
+    assert(huge.wireMap().size() == 0);
+}
+
+void test3()
+{
+    cout << "- Pixel volume -" << endl;
+    CubeLayout layout(cube);
+    PixelVolume volume(layout);
+    assert(volume.size() == 18);
+    assert(volume.layer_count() == 3);
+    assert((volume.row_count() == 2) && (volume.column_count() == 3));
+    volume(2, 1, 1) = 0x010203;
+    assert(volume[(1 * 6) + (1 * 3) + 2] == 0x010203);
+
+    PixelSlice layer = volume.sliceZ(1);
+    assert((layer.row_count() == 2) && (layer.column_count() == 3));
+    assert(layer(1, 2) == 0x010203);
+    PixelSlice front = volume.sliceY(1);
+    assert((front.row_count() == 3) && (front.column_count() == 3));
+    assert(front(1, 2) == 0x010203);
+    PixelSlice side = volume.sliceX(2);
+    assert((side.row_count() == 3) && (side.column_count() == 2));
+    assert(side(1, 1) == 0x010203);
+
+    side.fill(0x0000FF);
+    assert(volume(2, 0, 0) == 0x0000FF);
+    assert(volume(2, 1, 2) == 0x0000FF);
+    assert(volume(1, 1, 2) == 0);
+
+    PixelMatrix image{{0x111111, 0x222222}, {0x333333, 0x444444}};
+    volume.sliceZ(2).assign(image);
+    assert(volume(0, 0, 2) == 0x111111);
+    assert(volume(1, 1, 2) == 0x444444);
+    assert(volume(2, 1, 2) == 0x0000FF);
+    PixelMatrix copy;
+    static_cast<const PixelVolume &>(volume).sliceZ(2).copyTo(copy);
+    assert((copy.row_count() == 2) && (copy.column_count() == 3));
+    assert(copy(1, 0) == 0x333333);
+
+    volume.resize(2, 2, 2, 0x050505);
+    assert(volume.size() == 8);
+    assert((volume.layer_count() == 2) && (volume.column_count() == 2));
+}
+
+//-------------------------------------------------------------------
+// MAIN
+//-------------------------------------------------------------------
+
+int main()
+{
+    test1();
+    test2();
+    test3();
+    return 0;
+}
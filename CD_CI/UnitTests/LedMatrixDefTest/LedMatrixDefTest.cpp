@@ -542,6 +542,65 @@ void test8()
         assert(idx == 0);
     }
 }
+void test9()
+{
+    cout << "- Index <-> coordinates round trip -" << endl;
+    // Note: even sizes, too
+    for (size_t rows = 1; rows <= 4; rows++)
+        for (size_t columns = 1; columns <= 5; columns++)
+            for (int first = 0; first < 4; first++)
+                for (int arrangement = 0; arrangement < 2; arrangement++)
+                    for (int wiring = 0; wiring < 2; wiring++)
+                    {
+                        LedMatrixParameters params{
+                            .row_count = rows,
+                            .column_count = columns,
+                            .first_pixel =
+                                static_cast<LedMatrixFirstPixel>(first),
+                            .arrangement = static_cast<LedMatrixArrangement>(
+                                arrangement),
+                            .wiring = static_cast<LedMatrixWiring>(wiring),
+                        };
+                        for (size_t i = 0; i < params.size(); i++)
+                        {
+                            size_t row, col;
+                            params.indexToCoordinates(i, row, col);
+                            assert(params.coordinatesToIndex(row, col) == i);
+                        }
+                    }
+}
+
+void test10()
+{
+    cout << "- Compile-time layout -" << endl;
+    using Panel = LedMatrixLayout<
+        4,
+        6,
+        LedMatrixFirstPixel::bottom_right,
+        LedMatrixArrangement::columns,
+        LedMatrixWiring::serpentine>;
+    static_assert(Panel::pixel_count == 24);
+    static_assert(Panel::canonicalIndex(0) == 23);
+    static_assert(Panel::canonicalIndex(3) == 5);
+    static_assert(Panel::canonicalIndex(5) == 10);
+    static_assert(Panel::coordinatesToIndex(3, 5) == 0);
+    static_assert(Panel::wireIndex(Panel::canonicalIndex(13)) == 13);
+    static constexpr auto canonical = Panel::canonicalTable();
+    static constexpr auto wire = Panel::wireTable<uint8_t>();
+    for (size_t i = 0; i < Panel::pixel_count; i++)
+    {
+        assert(canonical[i] == Panel::parameters.canonicalIndex(i));
+        assert(wire[canonical[i]] == i);
+    }
+    constexpr LedMatrixParameters flipped = []()
+    {
+        LedMatrixParameters params = Panel::parameters;
+        params.flipVertical();
+        return params;
+    }();
+    static_assert(flipped.first_pixel == LedMatrixFirstPixel::top_right);
+}
+
 //-------------------------------------------------------------------
 // MAIN
 //-------------------------------------------------------------------
@@ -556,5 +615,7 @@ int main()
     test6();
     test7();
     test8();
+    test9();
+    test10();
     return 0;
 }
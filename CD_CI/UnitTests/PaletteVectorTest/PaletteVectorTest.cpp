@@ -0,0 +1,121 @@
+/**
+ * @file PaletteVectorTest.cpp
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Test palette-indexed vectors of pixels
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 license
+ */
+
+//-------------------------------------------------------------------
+// Imports
+//-------------------------------------------------------------------
+
+#include "PaletteVector.hpp"
+#include <iostream>
+#include <cassert>
+
+using namespace std;
+
+//-------------------------------------------------------------------
+// Tests
+//-------------------------------------------------------------------
+
+void test1()
+{
+    cout << "- Palette -" << endl;
+    PaletteVector pixels(4);
+    assert(pixels.size() == 4);
+    assert(pixels.paletteSize() == 256);
+    assert(pixels.color(0) == Pixel());
+    pixels.paletteColor(1) = 0xFF0000;
+    pixels[2] = 1;
+    assert(pixels.color(2) == 0xFF0000);
+    assert(pixels.color(1) == Pixel());
+    // 16 colors
+    PixelVector colors(16);
+    for (size_t i = 0; i < colors.size(); i++)
+        colors[i] = i;
+    pixels.palette(colors);
+    assert(pixels.paletteSize() == 16);
+    assert(pixels.color(2) == 1);
+    pixels[3] = 17;
+    assert(pixels.color(3) == 1);
+    assert(pixels.paletteColor(31) == 15);
+    const PaletteVector &ref = pixels;
+    assert(ref.palette()[5] == 5);
+}
+
+void test2()
+{
+    cout << "- Palette rotation -" << endl;
+    PaletteVector pixels(3);
+    PixelVector colors(16);
+    for (size_t i = 0; i < colors.size(); i++)
+        colors[i] = i;
+    pixels.palette(colors);
+    pixels[0] = 0;
+    pixels[1] = 1;
+    pixels[2] = 15;
+    pixels.rotatePalette(1);
+    assert(pixels.color(0) == 15);
+    assert(pixels.color(1) == 0);
+    assert(pixels.color(2) == 14);
+    pixels.rotatePalette(-1);
+    assert(pixels.color(0) == 0);
+    pixels.rotatePalette(-17);
+    assert(pixels.color(0) == 1);
+    assert(pixels.color(2) == 0);
+    // Range
+    pixels.palette(colors);
+    pixels.rotatePalette(1, 1, 3);
+    assert(pixels.paletteColor(0) == 0);
+    assert(pixels.paletteColor(1) == 3);
+    assert(pixels.paletteColor(2) == 1);
+    assert(pixels.paletteColor(3) == 2);
+    assert(pixels.paletteColor(4) == 4);
+    // Range beyond the palette size
+    pixels.palette(colors);
+    pixels.rotatePalette(1, 14, 200);
+    assert(pixels.paletteColor(14) == 15);
+    assert(pixels.paletteColor(15) == 14);
+    pixels.rotatePalette(1, 5, 5);
+    assert(pixels.paletteColor(5) == 5);
+}
+
+void test3()
+{
+    cout << "- Resolve colors -" << endl;
+    PaletteVector pixels(5);
+    pixels.fill(7);
+    pixels[4] = 3;
+    pixels.paletteColor(7) = 0x00FF00;
+    pixels.paletteColor(3) = 0x0000FF;
+    PixelVector result(2);
+    result.trackChanges(true);
+    pixels.toPixels(result);
+    assert(result.size() == 5);
+    assert(result[0] == 0x00FF00);
+    assert(result[3] == 0x00FF00);
+    assert(result[4] == 0x0000FF);
+    size_t first, last;
+    assert(result.dirtyRange(first, last));
+    assert((first == 0) && (last == 4));
+    PaletteVector empty;
+    empty.fill(1);
+    empty.toPixels(result);
+    assert(result.size() == 0);
+}
+
+//-------------------------------------------------------------------
+// MAIN
+//-------------------------------------------------------------------
+
+int main()
+{
+    test1();
+    test2();
+    test3();
+    return 0;
+}
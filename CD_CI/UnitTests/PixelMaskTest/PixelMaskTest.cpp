@@ -0,0 +1,161 @@
+/**
+ * @file PixelMaskTest.cpp
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Test one-bit masks of pixels
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 license
+ */
+
+//-------------------------------------------------------------------
+// Imports
+//-------------------------------------------------------------------
+
+#include "PixelMask.hpp"
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+
+using namespace std;
+
+//-------------------------------------------------------------------
+// Auxiliary
+//-------------------------------------------------------------------
+
+// Compare a mask to a matrix where non-black pixels are set bits
+bool equals(const PixelMask &mask, const PixelMatrix &expected)
+{
+    for (size_t r = 0; r < mask.row_count(); r++)
+        for (size_t c = 0; c < mask.column_count(); c++)
+            if (mask(r, c) != (expected.at(r, c) != Pixel()))
+                return false;
+    return true;
+}
+
+// Random mask and its equivalent matrix
+void random_mask(PixelMask &mask, PixelMatrix &matrix)
+{
+    for (size_t r = 0; r < mask.row_count(); r++)
+        for (size_t c = 0; c < mask.column_count(); c++)
+        {
+            bool value = (rand() % 2);
+            mask.set(r, c, value);
+            matrix.at(r, c) = (value) ? 1 : 0;
+        }
+}
+
+//-------------------------------------------------------------------
+// Tests
+//-------------------------------------------------------------------
+
+void test1()
+{
+    cout << "- Bit access -" << endl;
+    PixelMask mask(3, 40);
+    assert(mask.size() == 120);
+    assert(mask.wordsPerRow() == 2);
+    assert(mask.count() == 0);
+    mask.set(1, 35);
+    mask.set(2, 0);
+    assert(mask(1, 35));
+    assert(!mask(1, 34));
+    assert(mask.rowWords(1)[1] == (1U << 3));
+    assert(mask.count() == 2);
+    mask.clear(1, 35);
+    assert(!mask(1, 35));
+    mask.fill(true);
+    assert(mask.count() == 120);
+    assert(mask.rowWords(0)[1] == 0xFF);
+    mask.invert();
+    assert(mask.count() == 0);
+    mask.fill(PixelRect{1, 30, 5, 5}, true);
+    assert(mask.count() == 10);
+    assert(mask(2, 34));
+    assert(!mask(2, 35));
+    mask.fill(PixelRect{0, 0, 3, 40}, false);
+    assert(mask.count() == 0);
+    PixelMatrix image(2, 2);
+    image.at(1, 0) = 0x010000;
+    PixelMask from_image(image);
+    assert(from_image.count() == 1);
+    assert(from_image(1, 0));
+}
+
+void test2()
+{
+    cout << "- Scroll (same as PixelMatrix) -" << endl;
+    srand(1);
+    for (size_t columns : {5, 32, 45, 70})
+        for (auto direction : {ScrollDirection::up,
+                               ScrollDirection::down,
+                               ScrollDirection::left,
+                               ScrollDirection::right})
+            for (size_t count : {0, 1, 3, 33, 80})
+            {
+                PixelMask mask(4, columns);
+                PixelMatrix expected(4, columns);
+                random_mask(mask, expected);
+                mask.scroll(direction, count);
+                expected.scroll(direction, count, expected.bounds());
+                assert(equals(mask, expected));
+                for (bool value : {false, true})
+                {
+                    random_mask(mask, expected);
+                    mask.scroll(direction, count, value);
+                    expected.scroll(
+                        direction,
+                        count,
+                        expected.bounds(),
+                        (value) ? 1 : 0);
+                    assert(equals(mask, expected));
+                    assert(mask.count() <= mask.size());
+                }
+            }
+}
+
+void test3()
+{
+    cout << "- Compose -" << endl;
+    PixelMask mask(2, 40);
+    mask.set(0, 0);
+    mask.set(0, 39);
+    mask.set(1, 33);
+    PixelMatrix pixels(2, 40, 0x102030);
+    mask.tint(pixels, 0xFF0000);
+    assert(pixels.at(0, 0) == 0xFF0000);
+    assert(pixels.at(0, 39) == 0xFF0000);
+    assert(pixels.at(1, 33) == 0xFF0000);
+    assert(pixels.at(0, 1) == 0x102030);
+    pixels.fill(0x102030);
+    mask.invert(pixels);
+    assert(pixels.at(0, 0) == 0xEFDFCF);
+    assert(pixels.at(1, 0) == 0x102030);
+    pixels.fill(0x102030);
+    pixels.trackChanges(true);
+    pixels.markClean();
+    mask.mask(pixels);
+    assert(pixels.at(0, 0) == 0x102030);
+    assert(pixels.at(1, 33) == 0x102030);
+    assert(pixels.at(0, 1) == 0);
+    assert(pixels.at(1, 39) == 0);
+    assert(pixels.dirtyRow(1));
+    // Shorter vector
+    PixelVector strip(3, 0x102030);
+    mask.mask(strip);
+    assert(strip.size() == 3);
+    assert(strip[0] == 0x102030);
+    assert(strip[1] == 0);
+}
+
+//-------------------------------------------------------------------
+// MAIN
+//-------------------------------------------------------------------
+
+int main()
+{
+    test1();
+    test2();
+    test3();
+    return 0;
+}
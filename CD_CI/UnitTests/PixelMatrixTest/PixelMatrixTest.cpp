@@ -249,6 +249,530 @@ void test5()
     }
 }
 
+void test6()
+{
+    cout << "- Color statistics of an area -" << endl;
+    PixelMatrix test({
+        {0xFFFFFF, 0xFFFFFF, 0xFFFFFF},
+        {0xFFFFFF, 0x204060, 0x402060},
+        {0xFFFFFF, 0x204060, 0x402060},
+    });
+    PixelStatistics stats = test.statistics(PixelRect{1, 1, 2, 2});
+    assert(stats.count == 4);
+    assert(stats.mean == 0x303060);
+    assert(stats.max_channel == 0x60);
+    assert(stats.luminance == 0x40);
+    // Clipping
+    stats = test.statistics(PixelRect{2, 2, 5, 5});
+    assert(stats.count == 1);
+    assert(stats.mean == 0x402060);
+    stats = test.statistics(PixelRect{3, 0, 1, 1});
+    assert(stats.count == 0);
+    // Whole matrix
+    stats = test.statistics();
+    assert(stats.count == 9);
+
+    size_t histogram[4] = {0, 0, 0, 0};
+    test.hueHistogram(histogram, 4, PixelRect{0, 0, 3, 2});
+    assert(histogram[2] == 2);
+    assert(histogram[0] + histogram[1] + histogram[3] == 0);
+    PixelMatrix pink(2, 2, 0xFF0080);
+    pink.hueHistogram(histogram, 4, pink.bounds());
+    assert(histogram[3] == 4);
+}
+
+void test7()
+{
+    cout << "- Scroll a sub-rectangle (wrap) -" << endl;
+    PixelMatrix test({
+        {1, 2, 3, 4},
+        {5, 6, 7, 8},
+        {9, 10, 11, 12},
+    });
+    PixelRect area{0, 1, 3, 2};
+    {
+        PixelMatrix mtx(test);
+        mtx.scroll(ScrollDirection::up, 1, area);
+        PixelMatrix result({
+            {1, 6, 7, 4},
+            {5, 10, 11, 8},
+            {9, 2, 3, 12},
+        });
+        assert(mtx == result);
+    }
+    {
+        PixelMatrix mtx(test);
+        mtx.scroll(ScrollDirection::down, 4, area);
+        PixelMatrix result({
+            {1, 10, 11, 4},
+            {5, 2, 3, 8},
+            {9, 6, 7, 12},
+        });
+        assert(mtx == result);
+    }
+    {
+        PixelMatrix mtx(test);
+        mtx.scroll(ScrollDirection::left, 1, area);
+        PixelMatrix result({
+            {1, 3, 2, 4},
+            {5, 7, 6, 8},
+            {9, 11, 10, 12},
+        });
+        assert(mtx == result);
+    }
+    {
+        PixelMatrix mtx(test);
+        mtx.scroll(ScrollDirection::right, 1, PixelRect{1, 0, 9, 9});
+        PixelMatrix result({
+            {1, 2, 3, 4},
+            {8, 5, 6, 7},
+            {12, 9, 10, 11},
+        });
+        assert(mtx == result);
+    }
+}
+
+void test8()
+{
+    cout << "- Scroll a sub-rectangle (fill/feed) -" << endl;
+    PixelMatrix test({
+        {1, 2, 3, 4},
+        {5, 6, 7, 8},
+        {9, 10, 11, 12},
+    });
+    {
+        PixelMatrix mtx(test);
+        mtx.scroll(ScrollDirection::down, 1, mtx.bounds(), 0xFF);
+        PixelMatrix result({
+            {0xFF, 0xFF, 0xFF, 0xFF},
+            {1, 2, 3, 4},
+            {5, 6, 7, 8},
+        });
+        assert(mtx == result);
+    }
+    {
+        PixelMatrix mtx(test);
+        mtx.scroll(ScrollDirection::left, 2, PixelRect{0, 1, 2, 3}, 0);
+        PixelMatrix result({
+            {1, 4, 0, 0},
+            {5, 8, 0, 0},
+            {9, 10, 11, 12},
+        });
+        assert(mtx == result);
+    }
+    {
+        PixelMatrix mtx(test);
+        mtx.scroll(ScrollDirection::up, 9, mtx.bounds(), 0xFF);
+        assert_filled(mtx, 0xFF, "scroll(up,9,bounds,0xFF)");
+    }
+    PixelMatrix feed({
+        {20, 21},
+        {22, 23},
+    });
+    {
+        PixelMatrix mtx(test);
+        mtx.scroll(ScrollDirection::left, 1, mtx.bounds(), feed, 0, 1);
+        PixelMatrix result({
+            {2, 3, 4, 21},
+            {6, 7, 8, 23},
+            {10, 11, 12, 0},
+        });
+        assert(mtx == result);
+    }
+    {
+        PixelMatrix mtx(test);
+        mtx.scroll(ScrollDirection::up, 1, PixelRect{0, 0, 3, 3}, feed, 1, 0);
+        PixelMatrix result({
+            {5, 6, 7, 4},
+            {9, 10, 11, 8},
+            {22, 23, 0, 12},
+        });
+        assert(mtx == result);
+    }
+    {
+        // Feed from itself
+        PixelMatrix mtx(test);
+        mtx.scroll(ScrollDirection::right, 1, mtx.bounds(), mtx, 0, 3);
+        PixelMatrix result({
+            {4, 1, 2, 3},
+            {8, 5, 6, 7},
+            {12, 9, 10, 11},
+        });
+        assert(mtx == result);
+    }
+    {
+        // Feed from itself, partially out of bounds
+        PixelMatrix mtx(test);
+        mtx.scroll(ScrollDirection::down, 2, mtx.bounds(), mtx, 2, 1);
+        PixelMatrix result({
+            {10, 11, 12, 0},
+            {0, 0, 0, 0},
+            {1, 2, 3, 4},
+        });
+        assert(mtx == result);
+    }
+}
+
+void test9()
+{
+    cout << "- Change tracking -" << endl;
+    PixelMatrix mtx(4, 3);
+    size_t first, last;
+    assert(mtx.dirtyRow(2));
+    mtx.trackChanges(true);
+    for (size_t row = 0; row < 4; row++)
+        assert(mtx.dirtyRow(row));
+    mtx.markClean();
+    for (size_t row = 0; row < 4; row++)
+        assert(!mtx.dirtyRow(row));
+    mtx.at(2, 1) = 0xFF;
+    assert(!mtx.dirtyRow(0) && !mtx.dirtyRow(1));
+    assert(mtx.dirtyRow(2) && !mtx.dirtyRow(3));
+    assert(mtx.dirtyRange(first, last));
+    assert((first == 7) && (last == 7));
+    mtx.markClean();
+    mtx.scroll(ScrollDirection::left, 1, PixelRect{1, 1, 2, 2}, 0);
+    assert(!mtx.dirtyRow(0) && mtx.dirtyRow(1));
+    assert(mtx.dirtyRow(2) && !mtx.dirtyRow(3));
+    assert(mtx.dirtyRange(first, last));
+    assert((first == 4) && (last == 8));
+    mtx.markClean();
+    mtx.markDirty(PixelRect{3, 0, 1, 1});
+    assert(!mtx.dirtyRow(2) && mtx.dirtyRow(3));
+    mtx.markClean();
+    mtx.scroll_up(1);
+    assert(mtx.dirtyRow(0) && mtx.dirtyRow(3));
+    assert(!mtx.dirtyRow(4));
+}
+
+void test10()
+{
+    cout << "- Row and column views -" << endl;
+    PixelMatrix mtx({
+        {1, 2, 3},
+        {4, 5, 6},
+    });
+    assert(mtx(1, 2) == 6);
+    mtx(0, 1) = 7;
+    assert(mtx.at(0, 1) == 7);
+    PixelSpan row = mtx.row(1);
+    assert(row.size() == 3);
+    assert(row[0] == 4);
+    for (Pixel &pixel : row)
+        pixel = 8;
+    assert(mtx.at(1, 0) == 8);
+    assert(mtx.at(1, 2) == 8);
+    PixelStride column = mtx.column(2);
+    assert(column.size() == 2);
+    assert(column[0] == 3);
+    assert(column[1] == 8);
+    for (Pixel &pixel : column)
+        pixel = 9;
+    assert(mtx.at(0, 2) == 9);
+    assert(mtx.at(1, 2) == 9);
+    // Iteration
+    mtx.forEach(
+        [](size_t r, size_t c, Pixel &pixel)
+        { pixel = (r * 10) + c; });
+    assert(mtx.at(0, 0) == 0);
+    assert(mtx.at(1, 2) == 12);
+    const PixelMatrix &ref = mtx;
+    size_t sum = 0;
+    ref.forEach(
+        [&sum](size_t, size_t, const Pixel &pixel)
+        { sum += pixel.blue; });
+    assert(sum == (0 + 1 + 2 + 10 + 11 + 12));
+    assert(ref.row(1)[1] == 11);
+    assert(ref.column(1)[1] == 11);
+    // Const access reads storage in place and is not tracked
+    mtx.trackChanges(true);
+    mtx.markClean();
+    assert(&ref(1, 2) == &mtx[5]);
+    assert(ref.row(1).begin() == &mtx[3]);
+    assert(&ref.column(2)[1] == &mtx[5]);
+    size_t first, last;
+    assert(!mtx.dirtyRange(first, last));
+    // Assignment marks all pixels as dirty
+    PixelMatrix other(2, 3, 0x222222);
+    other.trackChanges(true);
+    other.markClean();
+    uint32_t shown = mtx.generation();
+    mtx = other;
+    assert(mtx.dirtyRange(shown, first, last));
+    assert((first == 0) && (last == 5));
+    assert(mtx.dirtyRow(0) && mtx.dirtyRow(1));
+}
+
+void test11()
+{
+    cout << "- Blit -" << endl;
+    PixelMatrix source(2, 3);
+    for (size_t i = 0; i < source.size(); i++)
+        source[i] = i + 1;
+    // Opaque and clipped
+    PixelMatrix mtx(3, 3);
+    mtx.blit(source, source.bounds(), 2, 1);
+    assert(mtx.at(2, 1) == 1);
+    assert(mtx.at(2, 2) == 2);
+    assert(mtx.at(1, 1) == 0);
+    mtx.fill(0);
+    mtx.blit(source, source.bounds(), -1, -1);
+    assert(mtx.at(0, 0) == 5);
+    assert(mtx.at(0, 1) == 6);
+    assert(mtx.at(1, 0) == 0);
+    mtx.fill(0);
+    mtx.blit(source, PixelRect{1, 1, 5, 5}, 0, 0);
+    assert(mtx.at(0, 0) == 5);
+    assert(mtx.at(0, 1) == 6);
+    assert(mtx.at(0, 2) == 0);
+    mtx.blit(source, source.bounds(), 3, 0);
+    mtx.blit(source, source.bounds(), 0, -3);
+    assert(mtx.at(0, 0) == 5);
+    // Color key
+    mtx.fill(9);
+    source.at(0, 1) = 0;
+    mtx.blit(source, source.bounds(), 0, 0, Pixel());
+    assert(mtx.at(0, 0) == 1);
+    assert(mtx.at(0, 1) == 9);
+    assert(mtx.at(0, 2) == 3);
+    assert(mtx.at(1, 1) == 5);
+    assert(mtx.at(2, 0) == 9);
+    // Mask
+    mtx.fill(9);
+    vector<bool> mask = {false, true, true, true};
+    mtx.blit(source, source.bounds(), 0, 0, mask);
+    assert(mtx.at(0, 0) == 9);
+    assert(mtx.at(0, 1) == 0);
+    assert(mtx.at(0, 2) == 3);
+    assert(mtx.at(1, 0) == 4);
+    assert(mtx.at(1, 1) == 9);
+    // Overlapping copy within the same matrix
+    for (size_t i = 0; i < mtx.size(); i++)
+        mtx[i] = i;
+    mtx.blit(mtx, PixelRect{0, 0, 2, 2}, 1, 1);
+    assert(mtx.at(1, 1) == 0);
+    assert(mtx.at(1, 2) == 1);
+    assert(mtx.at(2, 1) == 3);
+    assert(mtx.at(2, 2) == 4);
+    for (size_t i = 0; i < mtx.size(); i++)
+        mtx[i] = i;
+    mtx.blit(mtx, PixelRect{1, 1, 2, 2}, 0, 0);
+    assert(mtx.at(0, 0) == 4);
+    assert(mtx.at(0, 1) == 5);
+    assert(mtx.at(1, 0) == 7);
+    assert(mtx.at(1, 1) == 8);
+    PixelMatrix line({{1, 0, 2, 3}});
+    line.blit(line, PixelRect{0, 0, 1, 3}, 0, 1, Pixel());
+    assert(line == PixelMatrix({{1, 1, 2, 2}}));
+    // Change tracking
+    mtx.trackChanges(true);
+    mtx.markClean();
+    mtx.blit(source, source.bounds(), 1, 2);
+    assert(!mtx.dirtyRow(0));
+    assert(mtx.dirtyRow(1));
+    assert(mtx.dirtyRow(2));
+}
+
+void test12()
+{
+    cout << "- Resampling -" << endl;
+    PixelMatrix source(2, 2);
+    source.at(0, 0) = 10;
+    source.at(0, 1) = 20;
+    source.at(1, 0) = 30;
+    source.at(1, 1) = 40;
+    // Same size
+    for (auto filter : {ResampleFilter::nearest,
+                        ResampleFilter::bilinear,
+                        ResampleFilter::box})
+        assert(source.resampled(2, 2, filter) == source);
+    // Nearest upscale
+    PixelMatrix mtx = source.resampled(4, 6, ResampleFilter::nearest);
+    assert(mtx.at(0, 0) == 10);
+    assert(mtx.at(1, 2) == 10);
+    assert(mtx.at(1, 3) == 20);
+    assert(mtx.at(2, 0) == 30);
+    assert(mtx.at(3, 5) == 40);
+    // Box downscale
+    mtx.resample(source, ResampleFilter::box);
+    mtx = mtx.resampled(1, 1, ResampleFilter::box);
+    assert(mtx.at(0, 0) == 25);
+    mtx = source.resampled(1, 2, ResampleFilter::box);
+    assert(mtx.at(0, 0) == 20);
+    assert(mtx.at(0, 1) == 30);
+    // Box upscale behaves like nearest
+    mtx = source.resampled(4, 4, ResampleFilter::box);
+    assert(mtx.at(1, 1) == 10);
+    assert(mtx.at(3, 3) == 40);
+    // Bilinear upscale
+    PixelMatrix line(1, 2);
+    line.at(0, 0) = 0x000000;
+    line.at(0, 1) = 0xC86400;
+    mtx = line.resampled(2, 4);
+    assert(mtx.at(0, 0) == line.at(0, 0));
+    assert(mtx.at(1, 0) == line.at(0, 0));
+    assert(mtx.at(0, 1).red >= 49 && mtx.at(0, 1).red <= 51);
+    assert(mtx.at(0, 1).green >= 24 && mtx.at(0, 1).green <= 26);
+    assert(mtx.at(0, 2).red >= 149 && mtx.at(0, 2).red <= 151);
+    assert(mtx.at(0, 3) == line.at(0, 1));
+    assert(mtx.at(1, 3) == line.at(0, 1));
+    // Same matrix and change tracking
+    mtx = source;
+    mtx.trackChanges(true);
+    mtx.markClean();
+    mtx.resample(mtx, ResampleFilter::nearest);
+    assert(mtx.at(0, 0) == 10);
+    assert(mtx.at(0, 1) == 20);
+    assert(mtx.dirtyRow(0));
+    assert(mtx.dirtyRow(1));
+    PixelMatrix empty;
+    mtx.resample(empty);
+    assert(mtx.at(1, 1) == 0);
+}
+
+void test13()
+{
+    cout << "- Blur -" << endl;
+    PixelMatrix mtx(5, 5);
+    mtx.at(2, 2) = 0x0000FF;
+    PixelMatrix copy = mtx;
+    copy.boxBlur(1);
+    for (size_t r = 0; r < 5; r++)
+        for (size_t c = 0; c < 5; c++)
+        {
+            bool inside = (r >= 1) && (r <= 3) && (c >= 1) && (c <= 3);
+            assert(copy.at(r, c) == (inside ? 0x00001C : 0));
+        }
+    copy = mtx;
+    copy.gaussianBlur(1);
+    assert(copy.at(2, 2).blue > copy.at(2, 1).blue);
+    assert(copy.at(2, 1) == copy.at(1, 2));
+    assert(copy.at(0, 0) == copy.at(4, 4));
+    assert(copy.at(0, 4) == copy.at(4, 0));
+    // Non-square matrix
+    PixelMatrix wide(2, 6, 0x102030);
+    wide.boxBlur(2);
+    wide.gaussianBlur(2);
+    for (size_t i = 0; i < wide.size(); i++)
+        assert(wide[i] == 0x102030);
+}
+
+void test14()
+{
+    cout << "- Mirror symmetry -" << endl;
+    PixelMatrix mtx(3, 4);
+    PixelRect area = mtx.mirrorArea(Symmetry::horizontal);
+    assert((area.row_count == 3) && (area.column_count == 2));
+    area = mtx.mirrorArea(Symmetry::vertical);
+    assert((area.row_count == 2) && (area.column_count == 4));
+    area = mtx.mirrorArea(Symmetry::quadrant);
+    assert((area.row_count == 2) && (area.column_count == 2));
+    area = mtx.mirrorArea(Symmetry::octant);
+    assert((area.row_count == 2) && (area.column_count == 2));
+    // 1 2 . .
+    // 3 4 . .
+    // 5 6 . .
+    for (size_t i = 0; i < 6; i++)
+        mtx.at(i / 2, i % 2) = i + 1;
+    PixelMatrix copy = mtx;
+    copy.mirror(Symmetry::horizontal);
+    assert(copy.at(0, 3) == 1);
+    assert(copy.at(0, 2) == 2);
+    assert(copy.at(2, 3) == 5);
+    copy = mtx;
+    copy.mirror(Symmetry::vertical);
+    assert(copy.at(2, 0) == 1);
+    assert(copy.at(2, 1) == 2);
+    assert(copy.at(1, 0) == 3);
+    copy = mtx;
+    copy.mirror(Symmetry::quadrant);
+    assert(copy.at(2, 3) == 1);
+    assert(copy.at(2, 2) == 2);
+    assert(copy.at(1, 3) == 3);
+    // Octant
+    PixelMatrix square(5, 5);
+    square.at(0, 0) = 1;
+    square.at(0, 1) = 2;
+    square.at(0, 2) = 3;
+    square.at(1, 1) = 4;
+    square.at(1, 2) = 5;
+    square.at(2, 2) = 6;
+    square.trackChanges(true);
+    square.markClean();
+    square.mirror(Symmetry::octant);
+    for (size_t r = 0; r < 5; r++)
+        for (size_t c = 0; c < 5; c++)
+        {
+            assert(square.at(r, c) == square.at(c, r));
+            assert(square.at(r, c) == square.at(4 - r, c));
+            assert(square.at(r, c) == square.at(r, 4 - c));
+        }
+    assert(square.at(1, 0) == 2);
+    assert(square.at(4, 2) == 3);
+    assert(square.at(3, 3) == 4);
+    assert(square.dirtyRow(1));
+    assert(square.dirtyRow(4));
+}
+
+// Note: reference rotation, pixel by pixel
+static PixelMatrix rotated90(const PixelMatrix &source)
+{
+    PixelMatrix result(source.column_count(), source.row_count());
+    for (size_t r = 0; r < result.row_count(); r++)
+        for (size_t c = 0; c < result.column_count(); c++)
+            result(r, c) = source(source.row_count() - 1 - c, r);
+    return result;
+}
+
+void test15()
+{
+    cout << "- Transpose and rotate -" << endl;
+    const size_t sizes[][2] = {{1, 1}, {3, 5}, {17, 17}, {40, 9}, {33, 48}};
+    for (auto &size : sizes)
+    {
+        PixelMatrix original(size[0], size[1]);
+        for (size_t i = 0; i < original.size(); i++)
+            original[i] = i;
+        PixelMatrix m = original;
+        m.transpose();
+        assert(m.row_count() == size[1]);
+        assert(m.column_count() == size[0]);
+        for (size_t r = 0; r < m.row_count(); r++)
+            for (size_t c = 0; c < m.column_count(); c++)
+                assert(m(r, c) == original(c, r));
+        m.transpose();
+        assert(m == original);
+
+        PixelMatrix expected = rotated90(original);
+        m.rotate90clockwise();
+        assert(m == expected);
+        assert(m.row_count() == expected.row_count());
+        m.rotate90counterclockwise();
+        assert(m == original);
+        m.rotate180();
+        m.rotate90clockwise();
+        m.rotate90clockwise();
+        assert(m == original);
+    }
+}
+
+void test16()
+{
+    cout << "- Flip -" << endl;
+    PixelMatrix m{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}};
+    m.flipVertical();
+    assert(m == (PixelMatrix{{7, 8, 9}, {4, 5, 6}, {1, 2, 3}}));
+    m.flipHorizontal();
+    assert(m == (PixelMatrix{{9, 8, 7}, {6, 5, 4}, {3, 2, 1}}));
+    // Changes are tracked
+    m.trackChanges(true);
+    m.markClean();
+    m.transpose();
+    size_t first, last;
+    assert(m.dirtyRange(first, last));
+    assert((first == 0) && (last == 8));
+}
+
 //-------------------------------------------------------------------
 // MAIN
 //-------------------------------------------------------------------
@@ -260,5 +784,16 @@ int main()
     test3();
     test4();
     test5();
+    test6();
+    test7();
+    test8();
+    test9();
+    test10();
+    test11();
+    test12();
+    test13();
+    test14();
+    test15();
+    test16();
     return 0;
 }
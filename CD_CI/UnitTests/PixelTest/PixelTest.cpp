@@ -16,6 +16,7 @@
 #include "Pixel.hpp"
 #include <iostream>
 #include <cassert>
+#include <cmath>
 
 using namespace std;
 
@@ -39,6 +40,70 @@ using namespace std;
 // Auxiliary
 //-------------------------------------------------------------------
 
+/**
+ * @brief Floating-point HSL to RGB conversion (former implementation)
+ *
+ * @note Used as a reference for the fixed-point implementation.
+ *       Channel values are clamped to 255.
+ */
+Pixel reference_hsl(double hue, uint8_t saturation, uint8_t luminance)
+{
+    int c_255 = ((255 - ::std::abs((2 * luminance) - 255)) * saturation) / 254;
+    double x_aux =
+        ::std::abs(::std::fmod(hue / 60.0, (double)2.0) - 1.0);
+    int x_255 = c_255 * (10000 - (int)(x_aux * 10000)) / 10000;
+    int m_255 = luminance - (c_255 / 2);
+    int r, g, b;
+    if (hue >= 300)
+    {
+        r = c_255;
+        g = 0;
+        b = x_255;
+    }
+    else if (hue >= 240)
+    {
+        r = x_255;
+        g = 0;
+        b = c_255;
+    }
+    else if (hue >= 180)
+    {
+        r = 0;
+        g = x_255;
+        b = c_255;
+    }
+    else if (hue >= 120)
+    {
+        r = 0;
+        g = c_255;
+        b = x_255;
+    }
+    else if (hue >= 60)
+    {
+        r = x_255;
+        g = c_255;
+        b = 0;
+    }
+    else
+    {
+        r = c_255;
+        g = x_255;
+        b = 0;
+    }
+    Pixel result;
+    result.red = ::std::min(r + m_255, 255);
+    result.green = ::std::min(g + m_255, 255);
+    result.blue = ::std::min(b + m_255, 255);
+    return result;
+}
+
+bool within_one_lsb(const Pixel &a, const Pixel &b)
+{
+    return (::std::abs(a.red - b.red) <= 1) &&
+           (::std::abs(a.green - b.green) <= 1) &&
+           (::std::abs(a.blue - b.blue) <= 1);
+}
+
 //-------------------------------------------------------------------
 // Test groups
 //-------------------------------------------------------------------
@@ -270,6 +335,74 @@ void test6()
     assert(p == 0x1B1719);
 }
 
+void test7()
+{
+    cout << "- HSL->RGB conversion (fixed point vs floating point) -" << endl;
+    Pixel p;
+    for (unsigned int hue = 0; hue < 360; hue++)
+        for (unsigned int saturation = 0; saturation < 256; saturation += 15)
+            for (unsigned int luminance = 0; luminance < 256; luminance++)
+            {
+                Pixel expected = reference_hsl(hue, saturation, luminance);
+                p.hsl(hue, saturation, luminance);
+                if (!within_one_lsb(p, expected))
+                {
+                    cout << "Failure at hsl(" << hue << "," << saturation;
+                    cout << "," << luminance << ")" << endl;
+                    assert(false);
+                }
+                p.hsl16((hue * 65536 + 180) / 360, saturation, luminance);
+                if (!within_one_lsb(p, expected))
+                {
+                    cout << "Failure at hsl16(" << hue << "," << saturation;
+                    cout << "," << luminance << ")" << endl;
+                    assert(false);
+                }
+            }
+}
+
+void test8()
+{
+    cout << "- HSL->RGB conversion (8-bit hue) -" << endl;
+    Pixel p;
+    p.hsl8(0, 255, 127); // red
+    assert(p == 0xFF0000);
+    p.hsl8(85, 255, 127); // lime (not exact)
+    assert(p.green == 0xFF);
+    p.hsl8(128, 255, 127); // cyan
+    assert(p == 0x00FFFF);
+    for (unsigned int hue = 0; hue < 256; hue++)
+    {
+        p.hsl8(hue, 200, 100);
+        Pixel expected = reference_hsl((hue * 360.0) / 256.0, 200, 100);
+        assert(within_one_lsb(p, expected));
+    }
+}
+
+void test9()
+{
+    cout << "- Blend -" << endl;
+    for (unsigned int a = 0; a < 256; a++)
+        for (unsigned int b = 0; b < 256; b++)
+        {
+            Pixel p = a;
+            p.blend(b, 0);
+            assert(p == a);
+            p.blend(b, 255);
+            assert(p == b);
+            p = a;
+            p.blend(b, 128);
+            // Half way, rounded down
+            unsigned int mid = ((a * 127) + (b * 129)) >> 8;
+            assert(p.blue == mid);
+        }
+    Pixel p = 0xFF0000;
+    p.blend(0x0000FF, 127);
+    assert(p.red == 128);
+    assert(p.green == 0);
+    assert(p.blue == 126);
+}
+
 //-------------------------------------------------------------------
 // MAIN
 //-------------------------------------------------------------------
@@ -282,5 +415,8 @@ int main()
     test4();
     test5();
     test6();
+    test7();
+    test8();
+    test9();
     return 0;
 }
\ No newline at end of file
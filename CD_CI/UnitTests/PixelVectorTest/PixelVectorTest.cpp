@@ -15,6 +15,8 @@
 #include "PixelVector.hpp"
 #include <iostream>
 #include <cassert>
+#include <algorithm>
+#include <stdexcept>
 
 using namespace std;
 
@@ -269,6 +271,485 @@ void test6()
     }
 }
 
+void test7()
+{
+    cout << "- Fill with HSL colors -" << endl;
+    {
+        PixelVector test(4);
+        test.fillHue(0);
+        PixelVector result(4, Pixel(0xFF0000));
+        assert(test == result);
+    }
+    {
+        PixelVector test(300);
+        test.fillRainbow(0x8000, 0x1234, 200, 100);
+        uint16_t hue = 0x8000;
+        for (auto pixel : test)
+        {
+            Pixel expected;
+            expected.hsl16(hue, 200, 100);
+            assert(pixel == expected);
+            hue += 0x1234;
+        }
+    }
+    {
+        PixelVector test(6);
+        test.fillRainbow(0, 0x10000 / 6);
+        assert(test[0] == 0xFF0000);
+        assert(test[1].red >= 0xFE && test[1].green >= 0xFE);
+        assert(test[3].green >= 0xFE && test[3].blue >= 0xFE);
+    }
+}
+
+void test8()
+{
+    cout << "- Color statistics -" << endl;
+    {
+        PixelVector test({0xFF0000, 0x00FF00, 0x0000FF, 0x000000});
+        PixelStatistics stats = test.statistics();
+        assert(stats.count == 4);
+        assert(stats.mean == 0x3F3F3F);
+        assert(stats.max_channel == 0xFF);
+        assert(stats.luminance == 95);
+    }
+    {
+        PixelVector test({0xFF0000, 0x102030, 0x102030, 0x0000FF});
+        PixelStatistics stats = test.statistics(2, 1);
+        assert(stats.count == 2);
+        assert(stats.mean == 0x102030);
+        assert(stats.max_channel == 0x30);
+        assert(stats.luminance == 0x20);
+        stats = test.statistics(3, 9);
+        assert(stats.count == 1);
+        assert(stats.mean == 0x0000FF);
+        stats = test.statistics(5, 9);
+        assert(stats.count == 0);
+    }
+    {
+        PixelVector test;
+        PixelStatistics stats = test.statistics();
+        assert(stats.count == 0);
+        assert(stats.mean == 0);
+    }
+}
+
+void test9()
+{
+    cout << "- Hue histogram -" << endl;
+    PixelVector test({0xFF0000, 0x00FF00, 0x0000FF, 0x808080, 0xFF0000});
+    size_t histogram[3] = {0, 0, 0};
+    test.hueHistogram(histogram, 3);
+    assert(histogram[0] == 2);
+    assert(histogram[1] == 1);
+    assert(histogram[2] == 1);
+    size_t histogram2[2] = {0, 0};
+    test.hueHistogram(histogram2, 2, 1, 3);
+    assert(histogram2[0] == 1);
+    assert(histogram2[1] == 1);
+    // Hues in [300,360): magenta, pink and crimson
+    PixelVector reds({0xFF00FF, 0xFF0080, 0xFF0010, 0xFF1000});
+    size_t histogram8[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    reds.hueHistogram(histogram8, 8);
+    assert(histogram8[6] == 1);
+    assert(histogram8[7] == 2);
+    assert(histogram8[0] == 1);
+    PixelVector pink(4, 0xFF0080);
+    pink.hueHistogram(histogram8, 8);
+    assert(histogram8[7] == 6);
+}
+
+void test10()
+{
+    cout << "- Word-wise fill -" << endl;
+    for (size_t from = 0; from < 12; from++)
+        for (size_t to = from; to < 37; to++)
+        {
+            PixelVector test(37, 0x010203);
+            test.fill(0xA0B0C0, from, to);
+            for (size_t i = 0; i < test.size(); i++)
+                if ((i >= from) && (i <= to))
+                    assert(test[i] == 0xA0B0C0);
+                else
+                    assert(test[i] == 0x010203);
+        }
+    PixelVector test(19);
+    test.fill(0x123456);
+    for (auto pixel : test)
+        assert(pixel == 0x123456);
+}
+
+void test11()
+{
+    cout << "- Word-wise scale/fade -" << endl;
+    // All byte values, all factors, at every alignment
+    PixelVector test(256 / 3 + 1);
+    uint8_t *bytes = (uint8_t *)test.data();
+    for (unsigned int factor = 0; factor < 256; factor++)
+    {
+        for (size_t i = 0; i < test.size() * 3; i++)
+            bytes[i] = i;
+        test.scale(factor);
+        for (size_t i = 0; i < test.size() * 3; i++)
+        {
+            Pixel expected = (uint8_t)i;
+            expected.dim(factor);
+            assert(bytes[i] == expected.blue);
+        }
+    }
+    PixelVector fade(5, 0xFF8040);
+    fade.fadeToBlackBy(0);
+    assert(fade[4] == 0xFF8040);
+    fade.fadeToBlackBy(255);
+    assert(fade[4] == 0);
+}
+
+void test12()
+{
+    cout << "- Word-wise additive/maximum blend -" << endl;
+    // All byte pairs
+    PixelVector a(256 * 256 / 3 + 1);
+    PixelVector b(a.size());
+    uint8_t *a_bytes = (uint8_t *)a.data();
+    uint8_t *b_bytes = (uint8_t *)b.data();
+    size_t byte_count = 256 * 256;
+    auto init = [&]()
+    {
+        for (size_t i = 0; i < byte_count; i++)
+        {
+            a_bytes[i] = i & 0xFF;
+            b_bytes[i] = i >> 8;
+        }
+    };
+    init();
+    a.blendAdd(b);
+    for (size_t i = 0; i < byte_count; i++)
+    {
+        unsigned int sum = (i & 0xFF) + (i >> 8);
+        assert(a_bytes[i] == ((sum > 255) ? 255 : sum));
+    }
+    init();
+    a.blendMax(b);
+    for (size_t i = 0; i < byte_count; i++)
+        assert(a_bytes[i] == max(i & 0xFF, i >> 8));
+    // Different sizes
+    PixelVector c(3, 0x101010);
+    PixelVector d(2, 0x808080);
+    c.blendAdd(d);
+    assert(c[0] == 0x909090);
+    assert(c[1] == 0x909090);
+    assert(c[2] == 0x101010);
+    d.blendMax(c);
+    assert(d[0] == 0x909090);
+    assert(d.size() == 2);
+}
+
+void test13()
+{
+    cout << "- Crossfade -" << endl;
+    // All byte pairs, compared to Pixel::blend()
+    size_t byte_count = 256 * 256;
+    PixelVector from(byte_count / 3 + 1);
+    PixelVector to(from.size());
+    uint8_t *from_bytes = (uint8_t *)from.data();
+    uint8_t *to_bytes = (uint8_t *)to.data();
+    for (size_t i = 0; i < byte_count; i++)
+    {
+        from_bytes[i] = i & 0xFF;
+        to_bytes[i] = i >> 8;
+    }
+    PixelVector result(from.size());
+    for (unsigned int amount : {0, 1, 64, 127, 128, 200, 254, 255})
+    {
+        result.crossfade(from, to, amount);
+        uint8_t *result_bytes = (uint8_t *)result.data();
+        for (size_t i = 0; i < byte_count; i++)
+        {
+            Pixel expected = (uint8_t)(i & 0xFF);
+            expected.blend((uint8_t)(i >> 8), amount);
+            assert(result_bytes[i] == expected.blue);
+        }
+    }
+    // In place
+    PixelVector a(7, 0x000000);
+    PixelVector b(5, 0xFFFFFF);
+    a.crossfade(a, b, 255);
+    assert(a[4] == 0xFFFFFF);
+    assert(a[5] == 0x000000);
+}
+
+void test14()
+{
+    cout << "- Lerp towards -" << endl;
+    size_t byte_count = 256 * 256;
+    PixelVector current(byte_count / 3 + 1);
+    PixelVector target(current.size());
+    uint8_t *current_bytes = (uint8_t *)current.data();
+    uint8_t *target_bytes = (uint8_t *)target.data();
+    for (size_t i = 0; i < byte_count; i++)
+    {
+        current_bytes[i] = i & 0xFF;
+        target_bytes[i] = i >> 8;
+    }
+    // Single step: progress is guaranteed and never overshoots
+    PixelVector moved(current);
+    moved.lerpTowards(target, 1);
+    uint8_t *moved_bytes = (uint8_t *)moved.data();
+    for (size_t i = 0; i < byte_count; i++)
+    {
+        int a = current_bytes[i];
+        int b = target_bytes[i];
+        int c = moved_bytes[i];
+        if (a == b)
+            assert(c == a);
+        else if (a < b)
+            assert((c > a) && (c <= b));
+        else
+            assert((c < a) && (c >= b));
+    }
+    // Convergence
+    for (int step = 0; step < 256; step++)
+        current.lerpTowards(target, 1);
+    assert(current == target);
+    // No motion
+    PixelVector still(3, 0x102030);
+    still.lerpTowards(PixelVector(3, 0xFFFFFF), 0);
+    assert(still[0] == 0x102030);
+    still.lerpTowards(PixelVector(3, 0xFFFFFF), 255);
+    assert(still[2] == 0xFFFFFF);
+}
+
+void test15()
+{
+    cout << "- Indexing after shift and resize -" << endl;
+    PixelVector test({1, 2, 3, 4, 5});
+    test >> 2;
+    test.resize(3);
+    assert(test == PixelVector({4, 5, 1}));
+    assert(test[2] == 1);
+    assert(test.at(2) == 1);
+    // Bound checks
+    try
+    {
+        test.at(3);
+        assert(false && "at() out of bounds");
+    }
+    catch (std::out_of_range &)
+    {
+    }
+}
+
+void test16()
+{
+    cout << "- Change tracking -" << endl;
+    PixelVector test(10);
+    size_t first, last;
+    // Not tracked: always dirty
+    assert(!test.tracksChanges());
+    assert(test.dirtyRange(first, last));
+    assert((first == 0) && (last == 9));
+    test.markClean();
+    assert(test.dirtyRange(first, last));
+    // Tracked
+    test.trackChanges(true);
+    assert(test.dirtyRange(first, last));
+    assert((first == 0) && (last == 9));
+    test.markClean();
+    assert(!test.dirtyRange(first, last));
+    test[3] = 0xFFFFFF; // Not tracked
+    assert(!test.dirtyRange(first, last));
+    test.fill(0xFF, 5, 6);
+    test.at(2) = 0xFF;
+    assert(test.dirtyRange(first, last));
+    assert((first == 2) && (last == 6));
+    test.markClean();
+    test.markDirty(8, 20);
+    assert(test.dirtyRange(first, last));
+    assert((first == 8) && (last == 9));
+    test.markClean();
+    test.blendAdd(PixelVector(4, 0x01));
+    assert(test.dirtyRange(first, last));
+    assert((first == 0) && (last == 3));
+    test.markClean();
+    test >> 1;
+    assert(test.dirtyRange(first, last));
+    assert((first == 0) && (last == 9));
+    test.markClean();
+    test.scale(128);
+    assert(test.dirtyRange(first, last));
+    // Const access does not mark
+    test.markClean();
+    const PixelVector &ref = test;
+    (void)ref.at(1);
+    assert(!test.dirtyRange(first, last));
+    // Generations (one per display)
+    uint32_t shown = test.generation();
+    assert(!test.dirtyRange(shown, first, last));
+    test.fill(0, 2, 3);
+    assert(test.generation() != shown);
+    assert(test.dirtyRange(shown, first, last));
+    assert((first == 2) && (last == 3));
+    uint32_t shown_later = test.generation();
+    test.markClean();
+    test.at(7) = 0;
+    assert(test.dirtyRange(shown_later, first, last));
+    assert((first == 7) && (last == 7));
+    // Note: shown before markClean()
+    assert(test.dirtyRange(shown, first, last));
+    assert((first == 0) && (last == 9));
+    PixelVector other(3);
+    other.trackChanges(true);
+    assert(other.generation() != test.generation());
+    other.trackChanges(false);
+    assert(other.dirtyRange(other.generation(), first, last));
+    // Whole-content replacement marks all pixels as dirty
+    PixelVector a(10), b(10);
+    a.trackChanges(true);
+    b.trackChanges(true);
+    b.fill(0x222222);
+    b.markClean();
+    a.fill(0x111111);
+    shown = a.generation();
+    b.at(0) = 0x333333;
+    a = b;
+    assert(a.tracksChanges());
+    assert(a.dirtyRange(shown, first, last));
+    assert((first == 0) && (last == 9));
+    shown = a.generation();
+    a = PixelVector(10, 0x444444);
+    assert(a.dirtyRange(shown, first, last));
+    assert((first == 0) && (last == 9));
+    shown = a.generation();
+    a.swap(b);
+    assert(a.dirtyRange(shown, first, last));
+    assert((first == 0) && (last == 9));
+    shown = a.generation();
+    a.assign(10, 0x555555);
+    assert(a.dirtyRange(shown, first, last));
+    assert((first == 0) && (last == 9));
+    shown = a.generation();
+    a.resize(12);
+    assert(a.dirtyRange(shown, first, last));
+    assert((first == 0) && (last == 11));
+    a.markClean();
+    a.resize(4);
+    assert(a.dirtyRange(first, last));
+    assert((first == 0) && (last == 3));
+}
+
+void test17()
+{
+    cout << "- Blur -" << endl;
+    PixelVector pixels = {0, 0, 0x0000FF, 0, 0};
+    PixelVector copy = pixels;
+    copy.boxBlur(0);
+    assert(copy == pixels);
+    copy.boxBlur(1);
+    assert(copy[0] == 0);
+    assert(copy[1] == 0x000055);
+    assert(copy[2] == 0x000055);
+    assert(copy[3] == 0x000055);
+    assert(copy[4] == 0);
+    // Clamped ends
+    copy = {0x000030, 0, 0};
+    copy.boxBlur(1);
+    assert(copy[0] == 0x000020);
+    assert(copy[1] == 0x000010);
+    assert(copy[2] == 0);
+    // Radius longer than the vector: average of the clamped window
+    copy = {0x000090, 0};
+    copy.boxBlur(10);
+    assert(copy[0] == (0x90 * 11 + 10) / 21);
+    // A uniform vector does not change
+    copy = PixelVector(17, 0xFF8001);
+    copy.boxBlur(5);
+    copy.gaussianBlur(3);
+    for (size_t i = 0; i < copy.size(); i++)
+        assert(copy[i] == 0xFF8001);
+    // Gaussian blur is symmetric and preserves the peak position
+    copy = PixelVector(9);
+    copy[4] = 0xFFFFFF;
+    copy.gaussianBlur(1);
+    for (size_t i = 0; i < 4; i++)
+    {
+        assert(copy[i] == copy[8 - i]);
+        assert(copy[i].red <= copy[i + 1].red);
+    }
+    assert(copy[4].red > copy[3].red);
+    // Change tracking
+    copy = pixels;
+    copy.trackChanges(true);
+    copy.markClean();
+    copy.boxBlur(1);
+    assert(copy[1] == 0x000055);
+    assert(copy[0] == 0);
+    size_t first, last;
+    assert(copy.dirtyRange(first, last));
+}
+
+void test18()
+{
+    cout << "- Packed conversion -" << endl;
+    // Note: sizes not multiple of four
+    uint32_t packed[11];
+    for (size_t i = 0; i < 11; i++)
+        packed[i] = (0x010203 * (i + 1)) | 0xAA000000;
+    PixelVector pixels(10);
+    pixels.trackChanges(true);
+    pixels.markClean();
+    pixels.assignPacked(packed, 11);
+    for (size_t i = 0; i < 10; i++)
+        assert(pixels[i] == (packed[i] & 0xFFFFFF));
+    size_t first, last;
+    assert(pixels.dirtyRange(first, last));
+    assert((first == 0) && (last == 9));
+    pixels.markClean();
+    pixels.assignPacked(packed + 1, 3);
+    assert(pixels[2] == 0x04080C); // packed[3]
+    assert(pixels[3] == 0x04080C); // Unchanged
+    assert(pixels.dirtyRange(first, last));
+    assert((first == 0) && (last == 2));
+
+    uint32_t exported[11] = {0};
+    pixels.exportPacked(exported);
+    for (size_t i = 0; i < 10; i++)
+        assert(exported[i] == static_cast<uint32_t>(pixels[i]));
+    assert(exported[10] == 0);
+}
+
+void test19()
+{
+    cout << "- RGBX conversion -" << endl;
+    uint8_t rgbx[4 * 9];
+    for (size_t i = 0; i < 9; i++)
+    {
+        rgbx[4 * i] = i;
+        rgbx[4 * i + 1] = 0x40 + i;
+        rgbx[4 * i + 2] = 0x80 + i;
+        rgbx[4 * i + 3] = 0xFF;
+    }
+    PixelVector pixels(9);
+    pixels.assignRGBX(rgbx, 9);
+    for (size_t i = 0; i < 9; i++)
+    {
+        assert(pixels[i].red == i);
+        assert(pixels[i].green == 0x40 + i);
+        assert(pixels[i].blue == 0x80 + i);
+    }
+    uint8_t exported[4 * 9];
+    pixels.exportRGBX(exported);
+    for (size_t i = 0; i < 9; i++)
+    {
+        assert(exported[4 * i] == i);
+        assert(exported[4 * i + 1] == 0x40 + i);
+        assert(exported[4 * i + 2] == 0x80 + i);
+        assert(exported[4 * i + 3] == 0);
+    }
+    PixelVector empty;
+    empty.assignRGBX(rgbx, 9);
+    empty.exportRGBX(exported);
+    assert(empty.size() == 0);
+}
+
 //-------------------------------------------------------------------
 // MAIN
 //-------------------------------------------------------------------
@@ -281,5 +762,18 @@ int main()
     test4();
     test5();
     test6();
+    test7();
+    test8();
+    test9();
+    test10();
+    test11();
+    test12();
+    test13();
+    test14();
+    test15();
+    test16();
+    test17();
+    test18();
+    test19();
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,112 @@
+/**
+ * @file PixelViewportTest.cpp
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Test windows into a large pixel matrix
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 license
+ */
+
+//-------------------------------------------------------------------
+// Imports
+//-------------------------------------------------------------------
+
+#include "PixelViewport.hpp"
+#include <iostream>
+#include <cassert>
+
+using namespace std;
+
+//-------------------------------------------------------------------
+// Auxiliary
+//-------------------------------------------------------------------
+
+// Note: pixel value is row*16 + column
+static PixelMatrix canvas(size_t rows, size_t columns)
+{
+    PixelMatrix result(rows, columns);
+    for (size_t r = 0; r < rows; r++)
+        for (size_t c = 0; c < columns; c++)
+            result(r, c) = (r * 16) + c;
+    return result;
+}
+
+static uint32_t value(const Pixel &pixel)
+{
+    return (pixel.red << 16) | (pixel.green << 8) | pixel.blue;
+}
+
+//-------------------------------------------------------------------
+// Tests
+//-------------------------------------------------------------------
+
+void test1()
+{
+    cout << "- Wrap around -" << endl;
+    PixelMatrix big = canvas(4, 6);
+    PixelViewport view(big, 2, 3);
+    assert((view.row_count() == 2) && (view.column_count() == 3));
+    assert(view.size() == 6);
+    assert(value(view(1, 2)) == 0x12);
+    assert(value(view[5]) == 0x12);
+    view.moveTo(3, 5);
+    assert(value(view(0, 0)) == 0x35);
+    assert(value(view(0, 1)) == 0x30);
+    assert(value(view(1, 1)) == 0x00);
+    view.moveTo(-1, -7);
+    assert((view.row() == -1) && (view.column() == -7));
+    assert(value(view(0, 0)) == 0x35);
+    view.pan(1, 7);
+    assert(value(view(0, 0)) == 0x00);
+    view.moveTo(9, 13);
+    assert(value(view(0, 0)) == 0x11);
+}
+
+void test2()
+{
+    cout << "- Clamp -" << endl;
+    PixelMatrix big = canvas(4, 6);
+    PixelViewport view(big, 2, 3, ViewportEdge::clamp);
+    assert(view.edge() == ViewportEdge::clamp);
+    view.moveTo(-1, 4);
+    assert(value(view(0, 0)) == 0x04);
+    assert(value(view(0, 2)) == 0x05);
+    assert(value(view(1, 1)) == 0x05);
+    view.moveTo(3, -2);
+    assert(value(view(0, 0)) == 0x30);
+    assert(value(view(1, 2)) == 0x30);
+    assert(value(view(0, 2)) == 0x30);
+}
+
+void test3()
+{
+    cout << "- Copy and change canvas -" << endl;
+    PixelMatrix big = canvas(4, 6);
+    PixelViewport view(big, 2, 3);
+    view.moveTo(1, 2);
+    PixelMatrix window;
+    view.copyTo(window);
+    assert((window.row_count() == 2) && (window.column_count() == 3));
+    for (size_t r = 0; r < 2; r++)
+        for (size_t c = 0; c < 3; c++)
+            assert(window(r, c) == big(r + 1, c + 2));
+    // Note: the viewport is larger than the canvas
+    PixelMatrix small = canvas(1, 2);
+    view.canvas(small);
+    assert(&view.canvas() == &small);
+    assert(value(view(1, 2)) == 0x00);
+    assert(value(view(0, 1)) == 0x01);
+}
+
+//-------------------------------------------------------------------
+// MAIN
+//-------------------------------------------------------------------
+
+int main()
+{
+    test1();
+    test2();
+    test3();
+    return 0;
+}
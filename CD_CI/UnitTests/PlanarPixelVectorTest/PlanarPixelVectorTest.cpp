@@ -0,0 +1,156 @@
+/**
+ * @file PlanarPixelVectorTest.cpp
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Test vectors of pixels stored as separate color planes
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 license
+ */
+
+//-------------------------------------------------------------------
+// Imports
+//-------------------------------------------------------------------
+
+#include "PlanarPixelVector.hpp"
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+
+using namespace std;
+
+//-------------------------------------------------------------------
+// Auxiliary
+//-------------------------------------------------------------------
+
+PixelVector randomPixels(size_t count)
+{
+    PixelVector result(count);
+    for (size_t i = 0; i < count; i++)
+        result[i] = static_cast<uint32_t>(rand()) & 0xFFFFFF;
+    return result;
+}
+
+bool same(const PlanarPixelVector &planar, const PixelVector &pixels)
+{
+    if (planar.size() != pixels.size())
+        return false;
+    for (size_t i = 0; i < pixels.size(); i++)
+        if (planar.color(i) != pixels[i])
+            return false;
+    return true;
+}
+
+//-------------------------------------------------------------------
+// Tests
+//-------------------------------------------------------------------
+
+void test1()
+{
+    cout << "- Planes -" << endl;
+    PlanarPixelVector pixels(3, 0x123456);
+    assert(pixels.size() == 3);
+    assert(pixels.red()[2] == 0x12);
+    assert(pixels.green()[2] == 0x34);
+    assert(pixels.blue()[2] == 0x56);
+    pixels.color(1, 0xFF0000);
+    assert(pixels.color(1) == 0xFF0000);
+    assert(pixels.color(0) == 0x123456);
+    pixels.resize(5, 0x00FF00);
+    assert(pixels.size() == 5);
+    assert(pixels.color(2) == 0x123456);
+    assert(pixels.color(4) == 0x00FF00);
+    pixels.fill(0x0000FF);
+    assert(pixels.color(0) == 0x0000FF);
+    assert(pixels.color(4) == 0x0000FF);
+    PlanarPixelVector empty;
+    assert(empty.size() == 0);
+    empty.fill(0xFFFFFF);
+    empty.scale(127);
+}
+
+void test2()
+{
+    cout << "- Conversion -" << endl;
+    PixelVector original = randomPixels(37);
+    PlanarPixelVector planar(original);
+    assert(same(planar, original));
+    PixelVector result;
+    result.trackChanges(true);
+    planar.toPixels(result);
+    assert(result == original);
+    size_t first, last;
+    assert(result.dirtyRange(first, last));
+    assert((first == 0) && (last == 36));
+}
+
+void test3()
+{
+    cout << "- Bulk operations -" << endl;
+    // Note: sizes not multiple of the block size
+    PixelVector a = randomPixels(53);
+    PixelVector b = randomPixels(53);
+    PlanarPixelVector planar_a(a);
+    PlanarPixelVector planar_b(b);
+    PlanarPixelVector planar(a);
+    PixelVector expected = a;
+
+    expected.scale(100);
+    planar.scale(100);
+    assert(same(planar, expected));
+
+    expected.fadeToBlackBy(30);
+    planar.fadeToBlackBy(30);
+    assert(same(planar, expected));
+
+    expected.blendAdd(b);
+    planar.blendAdd(planar_b);
+    assert(same(planar, expected));
+
+    expected = a;
+    planar.assign(a);
+    expected.blendMax(b);
+    planar.blendMax(planar_b);
+    assert(same(planar, expected));
+
+    for (int amount : {0, 1, 127, 200, 255})
+    {
+        expected.crossfade(a, b, amount);
+        planar.crossfade(planar_a, planar_b, amount);
+        assert(same(planar, expected));
+    }
+
+    // Shorter operand
+    PlanarPixelVector small(3, 0xFFFFFF);
+    planar.assign(a);
+    planar.blendAdd(small);
+    assert(planar.color(2) == 0xFFFFFF);
+    assert(planar.color(3) == a[3]);
+}
+
+void test4()
+{
+    cout << "- Per-channel operations -" << endl;
+    PlanarPixelVector pixels(20, 0xFF8040);
+    pixels.scale(255, 127, 0);
+    assert(pixels.color(19) == 0xFF4000);
+    uint8_t invert[256];
+    for (int i = 0; i < 256; i++)
+        invert[i] = 255 - i;
+    pixels.applyTables(invert, nullptr, invert);
+    assert(pixels.color(0) == 0x0040FF);
+    assert(pixels.color(19) == 0x0040FF);
+}
+
+//-------------------------------------------------------------------
+// MAIN
+//-------------------------------------------------------------------
+
+int main()
+{
+    test1();
+    test2();
+    test3();
+    test4();
+    return 0;
+}
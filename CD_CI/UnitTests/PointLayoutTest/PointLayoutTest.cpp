@@ -0,0 +1,162 @@
+/**
+ * @file PointLayoutTest.cpp
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Test LEDs placed at arbitrary coordinates
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 license
+ */
+
+//-------------------------------------------------------------------
+// Imports
+//-------------------------------------------------------------------
+
+#include "PointLayout.hpp"
+#include <iostream>
+#include <cassert>
+#include <cstdlib>
+#include <set>
+
+using namespace std;
+
+//-------------------------------------------------------------------
+// Globals
+//-------------------------------------------------------------------
+
+// Note: a plus sign, center at (10,10)
+static constexpr LedPoint plus_sign[] = {
+    {10, 10, 0},
+    {20, 10, 0},
+    {10, 20, 0},
+    {0, 10, 0},
+    {10, 0, 0},
+};
+
+//-------------------------------------------------------------------
+// Tests
+//-------------------------------------------------------------------
+
+void test1()
+{
+    cout << "- Points and polar coordinates -" << endl;
+    PointLayout layout(plus_sign, 5);
+    assert(layout.size() == 5);
+    assert(layout.point(1).x == 20);
+    LedPoint min, max;
+    layout.bounds(min, max);
+    assert((min.x == 0) && (min.y == 0));
+    assert((max.x == 20) && (max.y == 20));
+    assert(layout.radius(0) == 0);
+    assert(layout.radius(1) == 10);
+    assert(layout.radius(4) == 10);
+    assert(layout.angle(1) == 0);
+    assert(layout.angle(2) == 16384);
+    assert(layout.angle(3) == 32768);
+    assert(layout.angle(4) == 49152);
+    layout.center(0, 10);
+    assert(layout.radius(1) == 20);
+    assert(layout.radius(2) == 14);
+    assert(layout.angle(2) == 8192);
+}
+
+void test2()
+{
+    cout << "- Binary blob -" << endl;
+    PointLayout layout(plus_sign, 5);
+    vector<uint8_t> blob = layout.blob();
+    assert(blob.size() == 1 + (5 * 2 * 2));
+    assert(blob[0] == 2);
+    PointLayout copy(blob.data(), blob.size());
+    assert(copy.size() == 5);
+    for (size_t i = 0; i < 5; i++)
+    {
+        assert(copy.point(i).x == plus_sign[i].x);
+        assert(copy.point(i).y == plus_sign[i].y);
+    }
+    // 3D, negative coordinates
+    LedPoint points[] = {{-300, 2, 1}, {4, -5, -600}};
+    PointLayout layout3d(points, 2);
+    blob = layout3d.blob();
+    assert(blob.size() == 1 + (2 * 3 * 2));
+    PointLayout copy3d(blob.data(), blob.size());
+    assert(copy3d.point(0).x == -300);
+    assert(copy3d.point(1).y == -5);
+    assert(copy3d.point(1).z == -600);
+}
+
+void test3()
+{
+    cout << "- Spatial queries -" << endl;
+    srand(7);
+    vector<LedPoint> points(500);
+    for (LedPoint &p : points)
+    {
+        p.x = (rand() % 2001) - 1000;
+        p.y = (rand() % 1001) - 500;
+    }
+    PointLayout layout(points.data(), points.size());
+    const int32_t queries[][3] = {
+        {0, 0, 100},
+        {-1000, -500, 300},
+        {1200, 0, 250},
+        {5000, 5000, 10},
+        {0, 0, 0},
+        {0, 0, 3000}};
+    for (auto &q : queries)
+    {
+        set<size_t> expected;
+        for (size_t i = 0; i < points.size(); i++)
+        {
+            int64_t dx = points[i].x - q[0];
+            int64_t dy = points[i].y - q[1];
+            if ((dx * dx) + (dy * dy) <= (int64_t)q[2] * q[2])
+                expected.insert(i);
+        }
+        set<size_t> found;
+        layout.forEachWithin(
+            q[0],
+            q[1],
+            q[2],
+            [&found](size_t index)
+            { assert(found.insert(index).second); });
+        assert(found == expected);
+    }
+    PointLayout empty(points.data(), 0);
+    empty.forEachWithin(0, 0, 10, [](size_t) { assert(false); });
+}
+
+void test4()
+{
+    cout << "- Canvas sampling -" << endl;
+    PointLayout layout(plus_sign, 5);
+    WireMap map = layout.wireMap(3, 5);
+    assert(map.size() == 5);
+    assert((map.row_count == 3) && (map.column_count == 5));
+    assert(map[0] == (1 * 5) + 2);
+    assert(map[1] == (1 * 5) + 4);
+    assert(map[2] == (2 * 5) + 2);
+    assert(map[3] == (1 * 5) + 0);
+    assert(map[4] == 2);
+    // Single point
+    PointLayout single(plus_sign, 1);
+    map = single.wireMap(3, 3);
+    assert(map[0] == 4);
+    // Canvas empty or too large for 16-bit indices
+    assert(layout.wireMap(0, 5).size() == 0);
+    assert(layout.wireMap(257, 256).size() == 0);
+    assert(layout.wireMap(256, 256).size() == 5);
+}
+
+//-------------------------------------------------------------------
+// MAIN
+//-------------------------------------------------------------------
+
+int main()
+{
+    test1();
+    test2();
+    test3();
+    test4();
+    return 0;
+}
@@ -0,0 +1,100 @@
+/**
+ * @file PowerBudgetTest.cpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Test power budgets
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 license
+ */
+
+//-------------------------------------------------------------------
+// Imports
+//-------------------------------------------------------------------
+
+#include "PixelDriver.hpp"
+#include <iostream>
+#include <cassert>
+
+using namespace std;
+
+//-------------------------------------------------------------------
+// Globals
+//-------------------------------------------------------------------
+
+#define PIXEL_COUNT 100
+
+//-------------------------------------------------------------------
+// Test groups
+//-------------------------------------------------------------------
+
+void test1()
+{
+    cout << "- Current draw estimation -" << endl;
+    PowerBudget budget;
+    // All black
+    assert(budget.milliamps(0, 0, 0, PIXEL_COUNT) == PIXEL_COUNT);
+    // All white
+    assert(budget.milliamps(
+               255 * PIXEL_COUNT,
+               255 * PIXEL_COUNT,
+               255 * PIXEL_COUNT,
+               PIXEL_COUNT) == (61 * PIXEL_COUNT));
+    // All red
+    assert(budget.milliamps(
+               255 * PIXEL_COUNT,
+               0,
+               0,
+               PIXEL_COUNT) == (21 * PIXEL_COUNT));
+    // All white at half brightness
+    assert(budget.milliamps(
+               255 * PIXEL_COUNT,
+               255 * PIXEL_COUNT,
+               255 * PIXEL_COUNT,
+               PIXEL_COUNT,
+               128) == (31 * PIXEL_COUNT));
+    // Scale to black
+    assert(budget.milliamps(
+               255 * PIXEL_COUNT,
+               255 * PIXEL_COUNT,
+               255 * PIXEL_COUNT,
+               PIXEL_COUNT,
+               0) == PIXEL_COUNT);
+}
+
+void test2()
+{
+    cout << "- Scale factor -" << endl;
+    PowerBudget budget;
+    // No limit
+    assert(budget.scale(1000000, PIXEL_COUNT) == 256);
+    // Within budget
+    budget.max_milliamps = 3100;
+    assert(budget.scale(3100, PIXEL_COUNT) == 256);
+    assert(budget.scale(500, PIXEL_COUNT) == 256);
+    // Over budget: all white requires 6100 mA
+    uint16_t factor = budget.scale(6100, PIXEL_COUNT);
+    assert(factor == 128);
+    uint32_t limited = budget.milliamps(
+        255 * PIXEL_COUNT,
+        255 * PIXEL_COUNT,
+        255 * PIXEL_COUNT,
+        PIXEL_COUNT,
+        factor);
+    assert(limited <= budget.max_milliamps);
+    // Budget below idle current
+    budget.max_milliamps = PIXEL_COUNT / 2;
+    assert(budget.scale(6100, PIXEL_COUNT) == 0);
+}
+
+//-------------------------------------------------------------------
+// MAIN
+//-------------------------------------------------------------------
+
+int main()
+{
+    test1();
+    test2();
+    return 0;
+}
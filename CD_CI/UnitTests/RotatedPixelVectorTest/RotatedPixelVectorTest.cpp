@@ -0,0 +1,167 @@
+/**
+ * @file RotatedPixelVectorTest.cpp
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Test virtual rotations of pixel vectors and matrices
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 license
+ */
+
+//-------------------------------------------------------------------
+// Imports
+//-------------------------------------------------------------------
+
+#include "RotatedPixelVector.hpp"
+#include <iostream>
+#include <cassert>
+
+using namespace std;
+
+//-------------------------------------------------------------------
+// Tests
+//-------------------------------------------------------------------
+
+void test1()
+{
+    cout << "- Vector rotation -" << endl;
+    PixelVector test({1, 2, 3, 4, 5});
+    for (ptrdiff_t count = -12; count <= 12; count++)
+    {
+        PixelVector expected(test);
+        if (count >= 0)
+            expected >> count;
+        else
+            expected << -count;
+        PixelVector pixels(test);
+        RotatedPixelVector rotated(pixels);
+        rotated.rotate(count);
+        for (size_t i = 0; i < test.size(); i++)
+            assert(rotated[i] == expected[i]);
+        // Note: the underlying pixels are not moved
+        assert(pixels == test);
+        rotated.compact();
+        assert(!rotated.rotated());
+        assert(pixels == expected);
+    }
+    // Accumulated rotations
+    PixelVector pixels(test);
+    RotatedPixelVector rotated(pixels);
+    rotated.rotate(2);
+    rotated.rotate(-5);
+    rotated.rotate(1);
+    assert(rotated.rotated());
+    assert(rotated[0] == 3);
+    assert(rotated[4] == 2);
+    assert(&rotated.pixels() == &pixels);
+    // Writes through the view
+    rotated[0] = 0;
+    assert(pixels[2] == 0);
+    // Empty and single-pixel vectors
+    PixelVector empty;
+    RotatedPixelVector none(empty);
+    none.rotate(3);
+    assert(!none.rotated());
+    PixelVector one(1);
+    RotatedPixelVector single(one);
+    single.rotate(-3);
+    single.rotate_left(1);
+    assert(!single.rotated());
+}
+
+void test2()
+{
+    cout << "- Matrix rotation -" << endl;
+    PixelMatrix test({
+        {1, 2, 3, 4},
+        {5, 6, 7, 8},
+        {9, 10, 11, 12},
+    });
+    for (size_t count = 0; count < 9; count++)
+        for (size_t vertical = 0; vertical < 4; vertical++)
+        {
+            PixelMatrix expected(test);
+            expected << count;
+            expected.scroll_up(vertical);
+            PixelMatrix pixels(test);
+            RotatedPixelVector rotated(pixels);
+            rotated.rotate_left(count);
+            rotated.rotate_up(vertical);
+            for (size_t row = 0; row < 3; row++)
+                for (size_t col = 0; col < 4; col++)
+                    assert(rotated(row, col) == expected.at(row, col));
+            rotated.compact();
+            assert(pixels == expected);
+
+            expected = test;
+            expected >> count;
+            expected.scroll_down(vertical);
+            pixels = test;
+            RotatedPixelVector other(pixels);
+            other.rotate_down(vertical);
+            other.rotate_right(count);
+            for (size_t i = 0; i < other.size(); i++)
+                assert(other[i] == expected[i]);
+            other.compact();
+            assert(pixels == expected);
+        }
+    // Row rotation followed by a whole rotation
+    PixelMatrix pixels({{0, 1, 2}, {3, 4, 5}});
+    PixelMatrix expected(pixels);
+    expected << 1;
+    static_cast<PixelVector &>(expected) >> 1;
+    RotatedPixelVector mixed(pixels);
+    mixed.rotate_left(1);
+    mixed.rotate(1);
+    for (size_t i = 0; i < mixed.size(); i++)
+        assert(mixed[i] == expected[i]);
+    mixed.compact();
+    assert(pixels == expected);
+    assert(pixels == PixelMatrix({{3, 1, 2}, {0, 4, 5}}));
+    // Whole rows commute with row rotations: no compaction
+    pixels = {{0, 1, 2}, {3, 4, 5}};
+    RotatedPixelVector by_rows(pixels);
+    by_rows.rotate_left(1);
+    by_rows.rotate(-3);
+    assert(by_rows(0, 0) == 4);
+    assert(pixels[0] == 0);
+    // Single column
+    PixelMatrix column({{1}, {2}, {3}});
+    RotatedPixelVector rotated(column);
+    rotated.rotate_left(1);
+    assert(!rotated.rotated());
+    rotated.rotate_up(1);
+    assert(rotated(0, 0) == 2);
+}
+
+void test3()
+{
+    cout << "- Change tracking -" << endl;
+    PixelMatrix pixels(2, 3);
+    pixels.trackChanges(true);
+    pixels.markClean();
+    RotatedPixelVector rotated(pixels);
+    rotated.rotate_right(1);
+    size_t first, last;
+    assert(pixels.dirtyRange(first, last));
+    assert((first == 0) && (last == 5));
+    pixels.markClean();
+    rotated.compact();
+    assert(pixels.dirtyRange(first, last));
+    // Not rotated: compact() does nothing
+    pixels.markClean();
+    rotated.compact();
+    assert(!pixels.dirtyRange(first, last));
+}
+
+//-------------------------------------------------------------------
+// MAIN
+//-------------------------------------------------------------------
+
+int main()
+{
+    test1();
+    test2();
+    test3();
+    return 0;
+}
@@ -0,0 +1,104 @@
+/**
+ * @file SegmentMapTest.cpp
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Test run-length mapping of folded LED strips
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 license
+ */
+
+//-------------------------------------------------------------------
+// Imports
+//-------------------------------------------------------------------
+
+#include "SegmentMap.hpp"
+#include <iostream>
+#include <cassert>
+
+using namespace std;
+
+//-------------------------------------------------------------------
+// Globals
+//-------------------------------------------------------------------
+
+// Note: -1 means a skipped LED
+static const int expected[] = {
+    -1, -1, 0, 1, 2, 3, // two dead LEDs, then pixels 0..3
+    7, 6, 5, 4,         // reversed run
+    -1, 8, 9,           // hidden LED at a corner
+    11, 10              // reversed run
+};
+
+static SegmentMap sample()
+{
+    SegmentMap map;
+    map.addSegment(0, 4, false, 2)
+        .addSegment(4, 4, true)
+        .addSegment(8, 2, false, 1)
+        .addSegment(10, 2, true);
+    return map;
+}
+
+//-------------------------------------------------------------------
+// Tests
+//-------------------------------------------------------------------
+
+void test1()
+{
+    cout << "- Counts -" << endl;
+    SegmentMap map = sample();
+    assert(map.size() == 4);
+    assert(map.ledCount() == 15);
+    assert(map.pixelCount() == 12);
+    assert(map[1].reversed);
+    assert(map[2].skip == 1);
+    SegmentMap empty;
+    assert(empty.ledCount() == 0);
+    assert(empty.pixelCount() == 0);
+}
+
+void test2()
+{
+    cout << "- Pixel index lookup -" << endl;
+    SegmentMap map = sample();
+    for (size_t led = 0; led < map.ledCount(); led++)
+    {
+        size_t pixel;
+        bool shown = map.pixelIndex(led, pixel);
+        assert(shown == (expected[led] >= 0));
+        if (shown)
+            assert(pixel == (size_t)expected[led]);
+    }
+    size_t pixel;
+    assert(!map.pixelIndex(map.ledCount(), pixel));
+}
+
+void test3()
+{
+    cout << "- Walk the data wire -" << endl;
+    SegmentMap map = sample();
+    SegmentMap::Cursor cursor;
+    for (size_t led = 0; led < map.ledCount(); led++)
+    {
+        size_t pixel;
+        bool shown = map.next(cursor, pixel);
+        assert(shown == (expected[led] >= 0));
+        if (shown)
+            assert(pixel == (size_t)expected[led]);
+    }
+    assert(cursor.segment == map.size());
+    assert(cursor.offset == 0);
+}
+
+//-------------------------------------------------------------------
+// MAIN
+//-------------------------------------------------------------------
+
+int main()
+{
+    test1();
+    test2();
+    test3();
+    return 0;
+}
@@ -0,0 +1,133 @@
+/**
+ * @file SpriteTest.cpp
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Test precompiled sprites
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 license
+ */
+
+//-------------------------------------------------------------------
+// Imports
+//-------------------------------------------------------------------
+
+#include "Sprite.hpp"
+#include <iostream>
+#include <cassert>
+
+using namespace std;
+
+//-------------------------------------------------------------------
+// Auxiliary
+//-------------------------------------------------------------------
+
+PixelMatrix test_image()
+{
+    // . 1 .
+    // 2 3 4
+    // . 5 .
+    PixelMatrix image(3, 3);
+    image.at(0, 1) = 1;
+    image.at(1, 0) = 2;
+    image.at(1, 1) = 3;
+    image.at(1, 2) = 4;
+    image.at(2, 1) = 5;
+    return image;
+}
+
+//-------------------------------------------------------------------
+// Tests
+//-------------------------------------------------------------------
+
+void test1()
+{
+    cout << "- Compilation -" << endl;
+    PixelMatrix image = test_image();
+    Sprite empty;
+    assert(empty.pixel_count() == 0);
+    assert(empty.run_count() == 0);
+    Sprite opaque(image);
+    assert(opaque.row_count() == 3);
+    assert(opaque.column_count() == 3);
+    assert(opaque.pixel_count() == 9);
+    assert(opaque.run_count() == 3);
+    Sprite keyed(image, Pixel());
+    assert(keyed.pixel_count() == 5);
+    assert(keyed.run_count() == 3);
+    Sprite masked(image, {true, false, true});
+    assert(masked.pixel_count() == 2);
+    assert(masked.run_count() == 2);
+}
+
+void test2()
+{
+    cout << "- Draw -" << endl;
+    Sprite sprite(test_image(), Pixel());
+    PixelMatrix mtx(4, 4, 9);
+    sprite.draw(mtx, 1, 1);
+    assert(mtx.at(0, 0) == 9);
+    assert(mtx.at(1, 1) == 9);
+    assert(mtx.at(1, 2) == 1);
+    assert(mtx.at(2, 1) == 2);
+    assert(mtx.at(2, 3) == 4);
+    assert(mtx.at(3, 1) == 9);
+    assert(mtx.at(3, 2) == 5);
+    // Draw an empty sprite
+    Sprite().draw(mtx, 0, 0);
+    assert(mtx.at(0, 0) == 9);
+}
+
+void test3()
+{
+    cout << "- Clipped draw -" << endl;
+    Sprite sprite(test_image(), Pixel());
+    PixelMatrix mtx(3, 3, 9);
+    sprite.draw(mtx, -1, -1);
+    assert(mtx.at(0, 0) == 3);
+    assert(mtx.at(0, 1) == 4);
+    assert(mtx.at(1, 0) == 5);
+    assert(mtx.at(1, 1) == 9);
+    mtx.fill(9);
+    sprite.draw(mtx, 2, 2);
+    assert(mtx.at(2, 2) == 9);
+    assert(mtx.at(2, 1) == 9);
+    mtx.fill(9);
+    sprite.draw(mtx, 1, 2);
+    assert(mtx.at(1, 2) == 9);
+    assert(mtx.at(2, 2) == 2);
+    // Out of bounds
+    mtx.fill(9);
+    sprite.draw(mtx, 3, 0);
+    sprite.draw(mtx, 0, -3);
+    sprite.draw(mtx, -3, 0);
+    for (size_t i = 0; i < mtx.size(); i++)
+        assert(mtx[i] == 9);
+}
+
+void test4()
+{
+    cout << "- Draw into tracked matrix -" << endl;
+    Sprite sprite(test_image(), Pixel());
+    PixelMatrix mtx(3, 3);
+    mtx.trackChanges(true);
+    mtx.markClean();
+    sprite.draw(mtx, 1, 0);
+    assert(mtx.at(1, 1) == 1);
+    assert(!mtx.dirtyRow(0));
+    assert(mtx.dirtyRow(1));
+    assert(mtx.dirtyRow(2));
+}
+
+//-------------------------------------------------------------------
+// MAIN
+//-------------------------------------------------------------------
+
+int main()
+{
+    test1();
+    test2();
+    test3();
+    test4();
+    return 0;
+}
@@ -0,0 +1,96 @@
+/**
+ * @file TextTickerTest.cpp
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Test scrolling text
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 license
+ */
+
+//-------------------------------------------------------------------
+// Imports
+//-------------------------------------------------------------------
+
+#include "TextTicker.hpp"
+#include <iostream>
+#include <cassert>
+
+using namespace std;
+
+//-------------------------------------------------------------------
+// Globals
+//-------------------------------------------------------------------
+
+// 3x2 glyph: lit pixels at (0,0), (1,0), (2,0) and (2,1)
+static const uint8_t test_data[] = {0x03, 0x21};
+static const BitmapGlyph test_glyphs[] = {{0, 2}};
+static const BitmapFont test_font(3, 'a', 'a', test_glyphs, test_data);
+
+//-------------------------------------------------------------------
+// Tests
+//-------------------------------------------------------------------
+
+void test1()
+{
+    cout << "- Ticker position -" << endl;
+    TextTicker ticker("aa", 2, test_font);
+    assert(ticker.period() == 2 + 1 + 2 + 2);
+    assert(ticker.position() == 0);
+    ticker.advance();
+    assert(ticker.position() == 1);
+    ticker.advance(-2);
+    assert(ticker.position() == 6);
+    ticker.advance(15);
+    assert(ticker.position() == 0);
+    ticker.setPosition(9);
+    assert(ticker.position() == 2);
+    ticker.setText("a");
+    assert(ticker.period() == 4);
+    assert(ticker.position() == 0);
+    ticker.setText("");
+    assert(ticker.period() == 2);
+    TextTicker empty("", 0, test_font);
+    assert(empty.period() == 1);
+    empty.advance(3);
+    assert(empty.position() == 0);
+}
+
+void test2()
+{
+    cout << "- Ticker window -" << endl;
+    TextTicker ticker("a", 1, test_font);
+    PixelMatrix mtx(4, 5, 9);
+    // Columns: 0b111, 0b100, 0 (gap)
+    ticker.draw(mtx, 1, 1, 2);
+    assert(mtx.at(0, 0) == 9);
+    assert(mtx.at(1, 0) == 1);
+    assert(mtx.at(1, 1) == 2);
+    assert(mtx.at(3, 1) == 1);
+    assert(mtx.at(1, 2) == 2);
+    assert(mtx.at(1, 3) == 1);
+    assert(mtx.at(3, 4) == 1);
+    ticker.advance();
+    ticker.draw(mtx, 1, 1, 2);
+    assert(mtx.at(1, 0) == 2);
+    assert(mtx.at(3, 0) == 1);
+    assert(mtx.at(1, 2) == 1);
+    // Clipped
+    mtx.fill(9);
+    ticker.draw(mtx, -2, 1, 2);
+    assert(mtx.at(0, 0) == 1);
+    assert(mtx.at(1, 0) == 9);
+    ticker.draw(mtx, 4, 1, 2);
+    assert(mtx.at(3, 3) == 9);
+}
+
+//-------------------------------------------------------------------
+// MAIN
+//-------------------------------------------------------------------
+
+int main()
+{
+    test1();
+    test2();
+    return 0;
+}
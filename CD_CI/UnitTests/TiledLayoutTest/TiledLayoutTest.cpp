@@ -0,0 +1,191 @@
+/**
+ * @file TiledLayoutTest.cpp
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Test LED matrix panels working as a single canvas
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 license
+ */
+
+//-------------------------------------------------------------------
+// Imports
+//-------------------------------------------------------------------
+
+#include "TiledLayout.hpp"
+#include <iostream>
+#include <cassert>
+
+using namespace std;
+
+//-------------------------------------------------------------------
+// Auxiliary
+//-------------------------------------------------------------------
+
+void checkWireMap(const TiledLayout &layout)
+{
+    WireMap map = layout.wireMap();
+    assert(map.size() == layout.size());
+    assert(map.row_count == layout.row_count());
+    assert(map.column_count == layout.column_count());
+    for (size_t i = 0; i < map.size(); i++)
+        assert(map[i] == layout.canonicalIndex(i));
+    // Note: no canvas pixel is shown twice
+    vector<bool> shown(map.canvasSize(), false);
+    for (size_t i = 0; i < map.size(); i++)
+    {
+        assert(map[i] < map.canvasSize());
+        assert(!shown[map[i]]);
+        shown[map[i]] = true;
+    }
+}
+
+//-------------------------------------------------------------------
+// Tests
+//-------------------------------------------------------------------
+
+void test1()
+{
+    cout << "- Grid of panels -" << endl;
+    // Two rows of two 2x3 panels, chained in serpentine
+    LedMatrixParameters grid{
+        .row_count = 2,
+        .column_count = 2,
+        .first_pixel = LedMatrixFirstPixel::top_left,
+        .arrangement = LedMatrixArrangement::rows,
+        .wiring = LedMatrixWiring::serpentine,
+    };
+    LedMatrixParameters panel{
+        .row_count = 2,
+        .column_count = 3,
+        .first_pixel = LedMatrixFirstPixel::top_left,
+        .arrangement = LedMatrixArrangement::rows,
+        .wiring = LedMatrixWiring::linear,
+    };
+    TiledLayout layout(grid, panel);
+    assert(layout.row_count() == 4);
+    assert(layout.column_count() == 6);
+    assert(layout.size() == 24);
+    assert(layout.panelCount() == 4);
+    // Chain: top-left, top-right, bottom-right, bottom-left
+    assert((layout.panel(1).row == 0) && (layout.panel(1).column == 3));
+    assert((layout.panel(2).row == 2) && (layout.panel(2).column == 3));
+    assert((layout.panel(3).row == 2) && (layout.panel(3).column == 0));
+    WireMap map = layout.wireMap();
+    // First panel
+    assert(map[0] == 0);
+    assert(map[2] == 2);
+    assert(map[3] == 6);
+    // Second panel
+    assert(map[6] == 3);
+    assert(map[9] == 9);
+    // Third panel
+    assert(map[12] == 15);
+    // Last pixel
+    assert(map[23] == 20);
+    checkWireMap(layout);
+}
+
+void test2()
+{
+    cout << "- Panels in their own orientation -" << endl;
+    TiledLayout layout(4, 6);
+    LedMatrixParameters panel{
+        .row_count = 4,
+        .column_count = 3,
+        .first_pixel = LedMatrixFirstPixel::bottom_left,
+        .arrangement = LedMatrixArrangement::columns,
+        .wiring = LedMatrixWiring::serpentine,
+    };
+    layout.addPanel(0, 0, panel);
+    // Second panel upside down
+    panel.flipVertical();
+    panel.flipHorizontal();
+    layout.addPanel(0, 3, panel);
+    assert(layout.size() == 24);
+    WireMap map = layout.wireMap();
+    assert(map[0] == 18);
+    assert(map[3] == 0);
+    assert(map[4] == 1);
+    assert(map[12] == 5);
+    assert(map[15] == 23);
+    checkWireMap(layout);
+}
+
+void test3()
+{
+    cout << "- Partial coverage -" << endl;
+    TiledLayout layout(4, 4);
+    LedMatrixParameters panel{
+        .row_count = 2,
+        .column_count = 2,
+        .first_pixel = LedMatrixFirstPixel::top_left,
+        .arrangement = LedMatrixArrangement::rows,
+        .wiring = LedMatrixWiring::serpentine,
+    };
+    layout.addPanel(2, 2, panel);
+    layout.addPanel(0, 0, panel);
+    assert(layout.size() == 8);
+    WireMap map = layout.wireMap();
+    assert(map.size() == 8);
+    assert(map[0] == 10);
+    assert(map[2] == 15);
+    assert(map[4] == 0);
+    checkWireMap(layout);
+    LedMatrixParameters canvas = layout.parameters();
+    assert(canvas.size() == 16);
+    assert(canvas.canonicalIndex(5) == 5);
+    TiledLayout empty(2, 2);
+    assert(empty.wireMap().size() == 0);
+    // Canvas too large for 16-bit indices
+    TiledLayout huge(300, 300);
+    huge.addPanel(299, 299, LedMatrixParameters{1, 1});
+    map = huge.wireMap();
+    assert(map.size() == 0);
+    huge.wireMap(map, 0);
+    assert(map.size() == 0);
+}
+
+void test4()
+{
+    cout << "- Change panel orientation -" << endl;
+    LedMatrixParameters grid{
+        .row_count = 1,
+        .column_count = 3,
+        .first_pixel = LedMatrixFirstPixel::top_left,
+        .arrangement = LedMatrixArrangement::rows,
+        .wiring = LedMatrixWiring::linear,
+    };
+    LedMatrixParameters panel{
+        .row_count = 4,
+        .column_count = 4,
+        .first_pixel = LedMatrixFirstPixel::top_left,
+        .arrangement = LedMatrixArrangement::rows,
+        .wiring = LedMatrixWiring::serpentine,
+    };
+    TiledLayout layout(grid, panel);
+    WireMap map = layout.wireMap();
+    WireMap before = map;
+    LedMatrixParameters rotated = panel;
+    rotated.rotate90clockwise();
+    layout.panelParameters(1, rotated);
+    layout.wireMap(map, 1);
+    assert(map == layout.wireMap());
+    for (size_t i = 0; i < map.size(); i++)
+        if ((i < 16) || (i >= 32))
+            assert(map[i] == before[i]);
+    assert(map[16] == 7);
+}
+
+//-------------------------------------------------------------------
+// MAIN
+//-------------------------------------------------------------------
+
+int main()
+{
+    test1();
+    test2();
+    test3();
+    test4();
+    return 0;
+}
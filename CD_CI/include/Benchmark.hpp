@@ -0,0 +1,84 @@
+/**
+ * @file Benchmark.hpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Helpers for host benchmarks
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 license
+ */
+
+#pragma once
+
+//-------------------------------------------------------------------
+// Imports
+//-------------------------------------------------------------------
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+//-------------------------------------------------------------------
+// Benchmark helpers
+//-------------------------------------------------------------------
+
+/// @brief Minimum measured time for each benchmark
+#define BENCHMARK_MIN_TIME ::std::chrono::milliseconds(100)
+
+/**
+ * @brief Measure the throughput of a kernel
+ *
+ * @note The kernel is run repeatedly until the minimum measured time
+ *       is reached
+ *
+ * @tparam Kernel Callable type
+ * @param items_per_run Count of items (usually pixels) processed in each run
+ * @param kernel Callable object to be measured
+ * @return double Items per second
+ */
+template <typename Kernel>
+double items_per_second(::std::size_t items_per_run, Kernel &&kernel)
+{
+    using clock = ::std::chrono::steady_clock;
+    ::std::size_t runs = 0;
+    auto start = clock::now();
+    auto elapsed = clock::duration::zero();
+    do
+    {
+        kernel();
+        runs++;
+        elapsed = clock::now() - start;
+    } while (elapsed < BENCHMARK_MIN_TIME);
+    double seconds = ::std::chrono::duration<double>(elapsed).count();
+    return (runs * items_per_run) / seconds;
+}
+
+/**
+ * @brief Print a benchmark result
+ *
+ * @param name Benchmark name
+ * @param rate Items per second
+ * @param baseline Items per second of the baseline (for speed-up)
+ */
+inline void report(const ::std::string &name, double rate, double baseline = 0.0)
+{
+    ::std::cout << "  " << ::std::left << ::std::setw(40) << name;
+    ::std::cout << ::std::right << ::std::setw(14) << ::std::fixed;
+    ::std::cout << ::std::setprecision(0) << rate << " items/s";
+    if (baseline > 0.0)
+        ::std::cout << "  x" << ::std::setprecision(2) << (rate / baseline);
+    ::std::cout << ::std::endl;
+}
+
+/// @brief Prevent the compiler from optimizing away a computed value
+/// @param value Computed value
+template <typename T>
+inline void keep(const T &value)
+{
+    static volatile T sink;
+    sink = value;
+    (void)sink;
+}
@@ -63,12 +63,13 @@ void chessboard_pattern()
     for (size_t row = 0; row < pixels.row_count(); row++)
     {
         bool white = (row % 2) ? 0 : 1;
-        for (size_t col = 0; col < pixels.column_count(); col++)
+        // Note: row() gives unchecked access to contiguous pixels
+        for (Pixel &pixel : pixels.row(row))
         {
             if (white)
-                pixels.at(row, col) = 0xFFFFFF;
+                pixel = 0xFFFFFF;
             else
-                pixels.at(row, col) = 0;
+                pixel = 0;
             white = !white;
         }
     }
@@ -81,12 +82,12 @@ void horizontal_pattern()
     for (size_t row = 0; row < pixels.row_count(); row++)
     {
         bool white = (row % 2) ? 0 : 1;
-        for (size_t col = 0; col < pixels.column_count(); col++)
+        for (Pixel &pixel : pixels.row(row))
         {
             if (white)
-                pixels.at(row, col) = 0xFFFFFF;
+                pixel = 0xFFFFFF;
             else
-                pixels.at(row, col) = 0x0000FF;
+                pixel = 0x0000FF;
         }
     }
     led_matrix.show(pixels);
@@ -99,11 +100,11 @@ void vertical_pattern()
     {
         bool white = (col % 2) ? 0 : 1;
         {
-            for (size_t row = 0; row < pixels.row_count(); row++)
+            for (Pixel &pixel : pixels.column(col))
                 if (white)
-                    pixels.at(row, col) = 0xFFFFFF;
+                    pixel = 0xFFFFFF;
                 else
-                    pixels.at(row, col) = 0xFF0000;
+                    pixel = 0xFF0000;
         }
     }
     led_matrix.show(pixels);
@@ -118,17 +119,15 @@ void fill_pattern(Pixel color)
 void diag1_pattern()
 {
     pixels = led_matrix.pixelMatrix();
-    for (size_t row = 0; row < pixels.row_count(); row++)
-    {
-        for (size_t col = 0; col < pixels.column_count(); col++)
+    pixels.forEach(
+        [](size_t row, size_t col, Pixel &pixel)
         {
             bool white = (row <= col);
             if (white)
-                pixels.at(row, col) = 0xFFFFFF;
+                pixel = 0xFFFFFF;
             else
-                pixels.at(row, col) = 0xFFFF00;
-        }
-    }
+                pixel = 0xFFFF00;
+        });
     led_matrix.show(pixels);
 }
 
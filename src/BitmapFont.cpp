@@ -0,0 +1,284 @@
+/**
+ * @file BitmapFont.cpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Bitmap fonts and text rendering
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 License
+ */
+
+#include "BitmapFont.hpp"
+#include <cassert>
+
+//------------------------------------------------------------------------------
+// Built-in font
+//------------------------------------------------------------------------------
+
+// Note: proportional 5x7 font for characters in the range [' ', '~'].
+// Blank columns have been trimmed from each glyph.
+
+static const uint8_t standard_font_data[] = {
+    0xF0, 0x60, 0x05, 0x11, 0x03, 0xB3, 0x40, 0x21, 0x11, 0x27, 0x21, 0x11,
+    0x27, 0x21, 0x11, 0x20, 0x21, 0x21, 0x21, 0x11, 0x11, 0x17, 0x11, 0x11,
+    0x11, 0x21, 0x21, 0x20, 0x02, 0x31, 0x12, 0x21, 0x51, 0x51, 0x22, 0x11,
+    0x32, 0x12, 0x12, 0x11, 0x21, 0x22, 0x11, 0x11, 0x11, 0x11, 0x31, 0x51,
+    0x11, 0x01, 0x11, 0x42, 0x50, 0x23, 0x31, 0x31, 0x11, 0x51, 0x01, 0x51,
+    0x11, 0x31, 0x33, 0x20, 0x21, 0x11, 0x51, 0x45, 0x41, 0x51, 0x11, 0x20,
+    0x31, 0x61, 0x45, 0x41, 0x61, 0x30, 0x41, 0x11, 0x42, 0x10, 0x31, 0x61,
+    0x61, 0x61, 0x61, 0x30, 0x52, 0x52, 0x51, 0x51, 0x51, 0x51, 0x51, 0x50,
+    0x15, 0x11, 0x31, 0x12, 0x21, 0x22, 0x11, 0x31, 0x15, 0x10, 0x11, 0x48,
+    0x61, 0x11, 0x42, 0x43, 0x31, 0x12, 0x21, 0x21, 0x12, 0x31, 0x01, 0x41,
+    0x11, 0x52, 0x11, 0x33, 0x11, 0x22, 0x32, 0x10, 0x32, 0x41, 0x11, 0x31,
+    0x21, 0x27, 0x41, 0x20, 0x03, 0x21, 0x11, 0x11, 0x32, 0x11, 0x32, 0x11,
+    0x32, 0x23, 0x10, 0x24, 0x21, 0x11, 0x22, 0x21, 0x22, 0x21, 0x21, 0x42,
+    0x10, 0x01, 0x61, 0x34, 0x21, 0x31, 0x11, 0x42, 0x50, 0x12, 0x12, 0x11,
+    0x21, 0x22, 0x21, 0x22, 0x21, 0x21, 0x12, 0x12, 0x10, 0x12, 0x41, 0x21,
+    0x22, 0x21, 0x22, 0x21, 0x11, 0x24, 0x20, 0x12, 0x12, 0x22, 0x12, 0x10,
+    0x12, 0x11, 0x11, 0x12, 0x12, 0x10, 0x31, 0x51, 0x11, 0x31, 0x31, 0x11,
+    0x51, 0x21, 0x11, 0x41, 0x11, 0x41, 0x11, 0x41, 0x11, 0x41, 0x11, 0x20,
+    0x01, 0x51, 0x11, 0x31, 0x31, 0x11, 0x51, 0x30, 0x11, 0x51, 0x61, 0x31,
+    0x12, 0x21, 0x42, 0x40, 0x11, 0x22, 0x11, 0x21, 0x22, 0x25, 0x51, 0x15,
+    0x10, 0x17, 0x31, 0x21, 0x31, 0x21, 0x31, 0x36, 0x08, 0x21, 0x22, 0x21,
+    0x22, 0x21, 0x21, 0x12, 0x12, 0x10, 0x15, 0x11, 0x52, 0x52, 0x51, 0x11,
+    0x31, 0x10, 0x08, 0x52, 0x51, 0x11, 0x31, 0x33, 0x20, 0x08, 0x21, 0x22,
+    0x21, 0x22, 0x21, 0x22, 0x51, 0x08, 0x21, 0x31, 0x21, 0x31, 0x61, 0x60,
+    0x15, 0x11, 0x52, 0x52, 0x31, 0x11, 0x11, 0x22, 0x10, 0x07, 0x31, 0x61,
+    0x61, 0x37, 0x01, 0x59, 0x51, 0x51, 0x72, 0x57, 0x11, 0x60, 0x07, 0x31,
+    0x51, 0x11, 0x31, 0x31, 0x11, 0x51, 0x07, 0x61, 0x61, 0x61, 0x61, 0x07,
+    0x11, 0x71, 0x51, 0x57, 0x07, 0x21, 0x71, 0x71, 0x27, 0x15, 0x11, 0x52,
+    0x52, 0x51, 0x15, 0x10, 0x08, 0x21, 0x31, 0x21, 0x31, 0x21, 0x42, 0x40,
+    0x15, 0x11, 0x52, 0x31, 0x12, 0x41, 0x24, 0x11, 0x08, 0x21, 0x31, 0x22,
+    0x21, 0x21, 0x11, 0x22, 0x31, 0x12, 0x32, 0x21, 0x22, 0x21, 0x22, 0x21,
+    0x22, 0x32, 0x10, 0x01, 0x61, 0x68, 0x61, 0x60, 0x06, 0x71, 0x61, 0x67,
+    0x10, 0x05, 0x71, 0x71, 0x51, 0x15, 0x20, 0x07, 0x51, 0x42, 0x71, 0x17,
+    0x02, 0x32, 0x21, 0x11, 0x51, 0x51, 0x11, 0x22, 0x32, 0x02, 0x71, 0x74,
+    0x21, 0x42, 0x50, 0x01, 0x43, 0x31, 0x12, 0x21, 0x22, 0x11, 0x33, 0x41,
+    0x08, 0x52, 0x51, 0x11, 0x71, 0x71, 0x71, 0x71, 0x10, 0x01, 0x52, 0x58,
+    0x21, 0x51, 0x51, 0x71, 0x71, 0x40, 0x61, 0x61, 0x61, 0x61, 0x61, 0x01,
+    0x71, 0x71, 0x40, 0x51, 0x31, 0x11, 0x11, 0x21, 0x11, 0x11, 0x21, 0x11,
+    0x11, 0x34, 0x07, 0x31, 0x21, 0x21, 0x31, 0x21, 0x31, 0x33, 0x10, 0x33,
+    0x31, 0x31, 0x21, 0x31, 0x21, 0x31, 0x51, 0x10, 0x33, 0x31, 0x31, 0x21,
+    0x31, 0x31, 0x28, 0x33, 0x31, 0x11, 0x11, 0x21, 0x11, 0x11, 0x21, 0x11,
+    0x11, 0x32, 0x20, 0x31, 0x47, 0x21, 0x31, 0x71, 0x50, 0x31, 0x51, 0x11,
+    0x41, 0x11, 0x11, 0x21, 0x11, 0x11, 0x24, 0x10, 0x07, 0x31, 0x51, 0x61,
+    0x74, 0x21, 0x32, 0x15, 0x61, 0x51, 0x71, 0x21, 0x32, 0x14, 0x10, 0x07,
+    0x41, 0x51, 0x11, 0x31, 0x31, 0x01, 0x58, 0x61, 0x25, 0x21, 0x72, 0x41,
+    0x74, 0x25, 0x31, 0x51, 0x61, 0x74, 0x33, 0x31, 0x31, 0x21, 0x31, 0x21,
+    0x31, 0x33, 0x10, 0x25, 0x21, 0x11, 0x41, 0x11, 0x41, 0x11, 0x51, 0x30,
+    0x31, 0x51, 0x11, 0x41, 0x11, 0x52, 0x45, 0x25, 0x31, 0x51, 0x61, 0x71,
+    0x30, 0x31, 0x21, 0x21, 0x11, 0x11, 0x21, 0x11, 0x11, 0x21, 0x11, 0x11,
+    0x51, 0x10, 0x21, 0x46, 0x31, 0x31, 0x61, 0x51, 0x10, 0x24, 0x71, 0x61,
+    0x51, 0x35, 0x23, 0x71, 0x71, 0x51, 0x33, 0x20, 0x24, 0x71, 0x42, 0x71,
+    0x24, 0x10, 0x21, 0x31, 0x31, 0x11, 0x51, 0x51, 0x11, 0x31, 0x31, 0x22,
+    0x71, 0x11, 0x41, 0x11, 0x41, 0x11, 0x24, 0x10, 0x21, 0x31, 0x21, 0x22,
+    0x21, 0x11, 0x11, 0x22, 0x21, 0x21, 0x31, 0x31, 0x42, 0x12, 0x11, 0x51,
+    0x07, 0x01, 0x51, 0x12, 0x12, 0x41, 0x30, 0x31, 0x51, 0x71, 0x71, 0x51,
+    0x30,
+};
+
+static const BitmapGlyph standard_font_glyphs[] = {
+    {0, 3}, // ' '
+    {2, 1}, // '!'
+    {4, 3}, // '"'
+    {7, 5}, // '#'
+    {16, 5}, // '$'
+    {28, 5}, // '%'
+    {37, 5}, // '&'
+    {49, 2}, // "'"
+    {53, 3}, // '('
+    {58, 3}, // ')'
+    {64, 5}, // '*'
+    {72, 5}, // '+'
+    {78, 2}, // ','
+    {82, 5}, // '-'
+    {88, 2}, // '.'
+    {90, 5}, // '/'
+    {96, 5}, // '0'
+    {106, 3}, // '1'
+    {109, 5}, // '2'
+    {118, 5}, // '3'
+    {128, 5}, // '4'
+    {136, 5}, // '5'
+    {147, 5}, // '6'
+    {157, 5}, // '7'
+    {165, 5}, // '8'
+    {177, 5}, // '9'
+    {187, 2}, // ':'
+    {192, 2}, // ';'
+    {198, 4}, // '<'
+    {205, 5}, // '='
+    {216, 4}, // '>'
+    {224, 5}, // '?'
+    {232, 5}, // '@'
+    {241, 5}, // 'A'
+    {248, 5}, // 'B'
+    {258, 5}, // 'C'
+    {266, 5}, // 'D'
+    {273, 5}, // 'E'
+    {281, 5}, // 'F'
+    {288, 5}, // 'G'
+    {297, 5}, // 'H'
+    {302, 3}, // 'I'
+    {305, 5}, // 'J'
+    {310, 5}, // 'K'
+    {318, 5}, // 'L'
+    {323, 5}, // 'M'
+    {328, 5}, // 'N'
+    {333, 5}, // 'O'
+    {340, 5}, // 'P'
+    {348, 5}, // 'Q'
+    {356, 5}, // 'R'
+    {365, 5}, // 'S'
+    {375, 5}, // 'T'
+    {380, 5}, // 'U'
+    {385, 5}, // 'V'
+    {391, 5}, // 'W'
+    {396, 5}, // 'X'
+    {405, 5}, // 'Y'
+    {411, 5}, // 'Z'
+    {420, 3}, // '['
+    {423, 5}, // backslash
+    {429, 3}, // ']'
+    {432, 5}, // '^'
+    {438, 5}, // '_'
+    {443, 3}, // '`'
+    {447, 5}, // 'a'
+    {458, 5}, // 'b'
+    {467, 5}, // 'c'
+    {476, 5}, // 'd'
+    {483, 5}, // 'e'
+    {495, 5}, // 'f'
+    {501, 5}, // 'g'
+    {512, 5}, // 'h'
+    {517, 3}, // 'i'
+    {521, 4}, // 'j'
+    {527, 4}, // 'k'
+    {533, 3}, // 'l'
+    {536, 5}, // 'm'
+    {541, 5}, // 'n'
+    {546, 5}, // 'o'
+    {555, 5}, // 'p'
+    {564, 5}, // 'q'
+    {571, 5}, // 'r'
+    {577, 5}, // 's'
+    {590, 5}, // 't'
+    {597, 5}, // 'u'
+    {602, 5}, // 'v'
+    {608, 5}, // 'w'
+    {614, 5}, // 'x'
+    {623, 5}, // 'y'
+    {632, 5}, // 'z'
+    {643, 3}, // '{'
+    {648, 1}, // '|'
+    {649, 3}, // '}'
+    {655, 5}, // '~'
+};
+
+static const BitmapFont standard_font(
+    7,
+    ' ',
+    '~',
+    standard_font_glyphs,
+    standard_font_data);
+
+const BitmapFont &BitmapFont::standard() noexcept
+{
+    return standard_font;
+}
+
+//------------------------------------------------------------------------------
+// Glyphs
+//------------------------------------------------------------------------------
+
+BitmapFont::size_type BitmapFont::textWidth(const char *text) const noexcept
+{
+    size_type width = 0;
+    if (text)
+        for (; *text; text++)
+            if (contains(*text))
+                width += glyphWidth(*text) + glyph_spacing;
+    return (width > 0) ? (width - glyph_spacing) : 0;
+}
+
+BitmapFont::size_type BitmapFont::rasterize(
+    char c,
+    uint32_t *columns) const noexcept
+{
+    assert(glyph_height <= max_height);
+    size_type width = glyphWidth(c);
+    if (width == 0)
+        return 0;
+    for (size_type i = 0; i < width; i++)
+        columns[i] = 0;
+    const uint8_t *code = data + glyphs[c - first_char].offset;
+    size_type pixel_count = width * glyph_height;
+    size_type pixel = 0;
+    while (pixel < pixel_count)
+    {
+        pixel += (*code >> 4);
+        size_type lit = (*code++ & 0x0F);
+        for (; lit && (pixel < pixel_count); lit--, pixel++)
+            columns[pixel / glyph_height] |= (1UL << (pixel % glyph_height));
+    }
+    return width;
+}
+
+//------------------------------------------------------------------------------
+// Text rendering
+//------------------------------------------------------------------------------
+
+BitmapFont::size_type BitmapFont::draw(
+    PixelMatrix &target,
+    const char *text,
+    ::std::ptrdiff_t row,
+    ::std::ptrdiff_t column,
+    const Pixel &color) const noexcept
+{
+    const ::std::ptrdiff_t rows = target.row_count();
+    const ::std::ptrdiff_t columns = target.column_count();
+    size_type width = textWidth(text);
+    if ((width == 0) ||
+        (row >= rows) ||
+        (row + glyph_height <= 0) ||
+        (column >= columns) ||
+        (column + static_cast<::std::ptrdiff_t>(width) <= 0))
+        return width;
+
+    ::std::ptrdiff_t top = (row < 0) ? 0 : row;
+    ::std::ptrdiff_t bottom = row + glyph_height;
+    if (bottom > rows)
+        bottom = rows;
+    target.markDirty(PixelRect{
+        static_cast<size_type>(top),
+        static_cast<size_type>((column < 0) ? 0 : column),
+        static_cast<size_type>(bottom - top),
+        width});
+
+    uint32_t glyph[256];
+    Pixel *pixels = target.data();
+    for (; *text && (column < columns); text++)
+    {
+        if (!contains(*text))
+            continue;
+        ::std::ptrdiff_t glyph_width = glyphWidth(*text);
+        if (column + glyph_width <= 0)
+        {
+            // Not visible: skip decoding
+            column += glyph_width + glyph_spacing;
+            continue;
+        }
+        rasterize(*text, glyph);
+        for (::std::ptrdiff_t i = 0; i < glyph_width; i++, column++)
+        {
+            if ((column < 0) || (column >= columns))
+                continue;
+            for (::std::ptrdiff_t r = top; r < bottom; r++)
+                if (glyph[i] & (1UL << (r - row)))
+                    pixels[(r * columns) + column] = color;
+        }
+        column += glyph_spacing;
+    }
+    return width;
+}
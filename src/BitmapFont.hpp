@@ -0,0 +1,180 @@
+/**
+ * @file BitmapFont.hpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Bitmap fonts and text rendering
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 License
+ */
+
+#pragma once
+
+//------------------------------------------------------------------------------
+
+#include <cstdint>
+#include <cstddef>
+#include "PixelVector.hpp"
+
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Location of a glyph in the font data
+ *
+ */
+struct BitmapGlyph
+{
+    /// @brief Index of the first byte of this glyph in the font data
+    uint16_t offset;
+    /// @brief Width of this glyph in pixels (may be zero)
+    uint8_t width;
+};
+
+/**
+ * @brief Proportional bitmap font using run-length encoded glyphs
+ *
+ * @note Glyph pixels are traversed in column-major order
+ *       (top to bottom, then left to right).
+ *       Each byte of the font data encodes a run of unlit pixels
+ *       (high nibble) followed by a run of lit pixels (low nibble).
+ *       Runs longer than 15 pixels are split using empty runs.
+ *       For example, a 3x2 glyph (3 rows, 2 columns) having lit pixels
+ *       at (0,0), (1,0), (2,0) and (2,1) is encoded as `0x03, 0x21`.
+ */
+class BitmapFont
+{
+public:
+    /// @brief Unsigned integer type
+    using size_type = PixelVector::size_type;
+
+    /// @brief Maximum glyph height in pixels
+    static constexpr uint8_t max_height = 32;
+
+    /**
+     * @brief Create a bitmap font from existing tables
+     *
+     * @note The tables are not copied, so they must remain valid
+     *       during the lifetime of this font.
+     *
+     * @param height Glyph height in pixels. Must not exceed @p max_height.
+     * @param first First character in the font
+     * @param last Last character in the font
+     * @param glyphs Table of glyphs, one for each character
+     *               in the range [@p first, @p last]
+     * @param data Run-length encoded glyph pixels
+     * @param spacing Unlit columns between glyphs
+     */
+    constexpr BitmapFont(
+        uint8_t height,
+        char first,
+        char last,
+        const BitmapGlyph *glyphs,
+        const uint8_t *data,
+        uint8_t spacing = 1) noexcept
+        : glyph_height{height},
+          first_char{first},
+          last_char{last},
+          glyph_spacing{spacing},
+          glyphs{glyphs},
+          data{data} {}
+
+    /**
+     * @brief Get a proportional 5x7 font for printable ASCII characters
+     *
+     * @return const BitmapFont& Built-in font
+     */
+    static const BitmapFont &standard() noexcept;
+
+    /**
+     * @brief Get the glyph height
+     *
+     * @return uint8_t Height in pixels
+     */
+    uint8_t height() const noexcept { return glyph_height; }
+
+    /**
+     * @brief Get the count of unlit columns between glyphs
+     *
+     * @return uint8_t Column count
+     */
+    uint8_t spacing() const noexcept { return glyph_spacing; }
+
+    /**
+     * @brief Check if a character has a glyph in this font
+     *
+     * @param c Character
+     * @return true If @p c has a glyph
+     * @return false Otherwise. Such characters are ignored.
+     */
+    bool contains(char c) const noexcept
+    {
+        return (c >= first_char) && (c <= last_char);
+    }
+
+    /**
+     * @brief Get the width of a glyph
+     *
+     * @param c Character
+     * @return size_type Width in pixels (zero if not in this font)
+     */
+    size_type glyphWidth(char c) const noexcept
+    {
+        return contains(c) ? glyphs[c - first_char].width : 0;
+    }
+
+    /**
+     * @brief Get the width of a text, including spacing
+     *
+     * @param text Null-terminated text
+     * @return size_type Width in pixels
+     */
+    size_type textWidth(const char *text) const noexcept;
+
+    /**
+     * @brief Decode the columns of a glyph
+     *
+     * @param c Character
+     * @param columns Destination of glyphWidth(@p c) columns.
+     *                Bit N of each column is set if the pixel
+     *                at row N is lit.
+     * @return size_type Count of decoded columns
+     */
+    size_type rasterize(char c, uint32_t *columns) const noexcept;
+
+    /**
+     * @brief Draw a text into a matrix
+     *
+     * @note The text is clipped to the bounds of @p target.
+     *       Unlit pixels are left untouched.
+     *
+     * @param target Matrix to draw into
+     * @param text Null-terminated text
+     * @param row Row of the top-left pixel of the text in @p target.
+     *            May be negative.
+     * @param column Column of the top-left pixel of the text
+     *               in @p target. May be negative.
+     * @param color Color of lit pixels
+     * @return size_type Width of the text in pixels
+     */
+    size_type draw(
+        PixelMatrix &target,
+        const char *text,
+        ::std::ptrdiff_t row,
+        ::std::ptrdiff_t column,
+        const Pixel &color) const noexcept;
+
+private:
+    /// @brief Glyph height in pixels
+    uint8_t glyph_height;
+    /// @brief First character in the font
+    char first_char;
+    /// @brief Last character in the font
+    char last_char;
+    /// @brief Unlit columns between glyphs
+    uint8_t glyph_spacing;
+    /// @brief Table of glyphs
+    const BitmapGlyph *glyphs;
+    /// @brief Run-length encoded glyph pixels
+    const uint8_t *data;
+};
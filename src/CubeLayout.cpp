@@ -0,0 +1,86 @@
+/**
+ * @file CubeLayout.cpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief LED cubes made of stacked LED matrices
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 License
+ */
+
+#include "CubeLayout.hpp"
+#include <cassert>
+
+//------------------------------------------------------------------------------
+// Layers
+//------------------------------------------------------------------------------
+
+CubeLayout::CubeLayout(const LedCubeParameters &params)
+    : layers{params.layer_count},
+      rows{params.layer.row_count},
+      columns{params.layer.column_count}
+{
+    chain.reserve(layers);
+    for (::std::size_t i = 0; i < layers; i++)
+        addLayer(
+            (params.first_layer == LedCubeFirstLayer::bottom)
+                ? i
+                : (layers - 1 - i),
+            params.layer,
+            (params.layer_wiring == LedMatrixWiring::serpentine) && (i & 1));
+}
+
+void CubeLayout::addLayer(
+    ::std::size_t z,
+    const LedMatrixParameters &params,
+    bool reversed)
+{
+    assert(z < layers);
+    assert((params.row_count == rows) && (params.column_count == columns));
+#ifndef NDEBUG
+    for (const LedCubeLayer &other : chain)
+        assert(other.z != z);
+#endif
+    LedCubeLayer layer;
+    layer.z = z;
+    layer.params = params;
+    layer.reversed = reversed;
+    chain.push_back(layer);
+}
+
+//------------------------------------------------------------------------------
+// Mapping
+//------------------------------------------------------------------------------
+
+::std::size_t CubeLayout::canonicalIndex(::std::size_t index) const noexcept
+{
+    assert(index < size());
+    ::std::size_t layer_size = rows * columns;
+    const LedCubeLayer &layer = chain[index / layer_size];
+    ::std::size_t offset = index % layer_size;
+    if (layer.reversed)
+        offset = layer_size - 1 - offset;
+    return (layer.z * layer_size) + layer.params.canonicalIndex(offset);
+}
+
+WireMap CubeLayout::wireMap() const
+{
+    if (!WireMap::fits(layers * rows, columns))
+        return WireMap();
+    ::std::size_t layer_size = rows * columns;
+    WireMap map(size());
+    map.row_count = layers * rows;
+    map.column_count = columns;
+    WireMap::index_type *entry = map.data();
+    for (const LedCubeLayer &layer : chain)
+    {
+        ::std::size_t base = layer.z * layer_size;
+        for (::std::size_t i = 0; i < layer_size; i++)
+        {
+            ::std::size_t offset = (layer.reversed) ? (layer_size - 1 - i) : i;
+            *entry++ = base + layer.params.canonicalIndex(offset);
+        }
+    }
+    return map;
+}
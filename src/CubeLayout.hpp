@@ -0,0 +1,256 @@
+/**
+ * @file CubeLayout.hpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief LED cubes made of stacked LED matrices
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 License
+ */
+
+#pragma once
+
+//------------------------------------------------------------------------------
+
+#include <vector>
+#include <cstddef>
+#include "PixelDriver.hpp"
+#include "WireMap.hpp"
+
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Location of the first layer in the pixel chain
+ *
+ */
+enum class LedCubeFirstLayer : unsigned char
+{
+    /// @brief First layer is the bottom one (z = 0)
+    bottom,
+    /// @brief First layer is the top one
+    top
+};
+
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Working parameters of an LED cube made of identical layers
+ *
+ * @note Coordinates: x is the column, y is the row (as seen from above)
+ *       and z is the layer, being 0 the bottom one.
+ *
+ * @note Canonical index: `((z * row_count) + y) * column_count + x`,
+ *       so each layer is a contiguous PixelMatrix-like slice
+ *       (see PixelVolume).
+ */
+struct LedCubeParameters
+{
+    /// @brief Working parameters of the first layer in the pixel chain
+    LedMatrixParameters layer;
+    /// @brief Number of layers
+    ::std::size_t layer_count = 0;
+    /// @brief First layer in the pixel chain
+    LedCubeFirstLayer first_layer = LedCubeFirstLayer::bottom;
+    /// @brief Wiring schema between layers
+    /// @note Serpentine: the last pixel of a layer is connected
+    ///       to the pixel above (or below) it, so every other layer
+    ///       is chained in reverse order.
+    ///       Linear: every layer is chained in the same order.
+    LedMatrixWiring layer_wiring = LedMatrixWiring::serpentine;
+
+    /**
+     * @brief Get the count of pixels
+     *
+     * @return constexpr ::std::size_t Count of pixels
+     */
+    constexpr ::std::size_t size() const noexcept
+    {
+        return layer.size() * layer_count;
+    }
+
+    /**
+     * @brief Retrieve the coordinates of a pixel index
+     *
+     * @param index Pixel index in the data wire
+     * @param[out] x Column
+     * @param[out] y Row
+     * @param[out] z Layer
+     */
+    constexpr void indexToCoordinates(
+        ::std::size_t index,
+        ::std::size_t &x,
+        ::std::size_t &y,
+        ::std::size_t &z) const noexcept
+    {
+        assert(index < size());
+        ::std::size_t layer_size = layer.size();
+        ::std::size_t chain = index / layer_size;
+        ::std::size_t offset = index % layer_size;
+        if ((layer_wiring == LedMatrixWiring::serpentine) && (chain & 1))
+            offset = layer_size - 1 - offset;
+        z = (first_layer == LedCubeFirstLayer::bottom)
+                ? chain
+                : (layer_count - 1 - chain);
+        layer.indexToCoordinates(offset, y, x);
+    }
+
+    /**
+     * @brief Retrieve the canonical index of a pixel index
+     *
+     * @param index Pixel index in the data wire
+     * @return constexpr ::std::size_t Canonical pixel index
+     */
+    constexpr ::std::size_t canonicalIndex(::std::size_t index) const noexcept
+    {
+        ::std::size_t x = 0, y = 0, z = 0;
+        indexToCoordinates(index, x, y, z);
+        return (((z * layer.row_count) + y) * layer.column_count) + x;
+    }
+};
+
+//------------------------------------------------------------------------------
+
+/**
+ * @brief LED matrix placed as a layer of an LED cube
+ *
+ */
+struct LedCubeLayer
+{
+    /// @brief Layer index (z coordinate)
+    ::std::size_t z = 0;
+    /// @brief Working parameters of this layer, as seen from above
+    LedMatrixParameters params;
+    /// @brief True if this layer is chained in reverse order
+    bool reversed = false;
+};
+
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Several LED matrices stacked as an LED cube
+ *        and daisy-chained in a single data wire
+ *
+ * @note Each layer has its own working parameters,
+ *       so each one may have its own orientation and wiring.
+ *       Layers are chained in the order they were added.
+ *
+ * @note The canvas is a PixelVolume having layer_count() layers,
+ *       row_count() rows and column_count() columns.
+ */
+class CubeLayout
+{
+public:
+    /**
+     * @brief Create a cube with no layers
+     *
+     * @param layer_count Number of layers
+     * @param row_count Number of rows in each layer
+     * @param column_count Number of columns in each layer
+     */
+    CubeLayout(
+        ::std::size_t layer_count,
+        ::std::size_t row_count,
+        ::std::size_t column_count) noexcept
+        : layers{layer_count}, rows{row_count}, columns{column_count} {}
+
+    /**
+     * @brief Create a cube of identical layers
+     *
+     * @param params Working parameters of the cube
+     */
+    CubeLayout(const LedCubeParameters &params);
+
+    /**
+     * @brief Add a layer at the end of the chain
+     *
+     * @warning The layer must fit in the cube and
+     *          must not be added twice.
+     *          Checked with assertions, only.
+     *
+     * @param z Layer index (0 is the bottom one)
+     * @param params Working parameters of the layer, as seen from above
+     * @param reversed True to chain the layer in reverse order
+     */
+    void addLayer(
+        ::std::size_t z,
+        const LedMatrixParameters &params,
+        bool reversed = false);
+
+    /**
+     * @brief Get the number of layers in the canvas
+     *
+     * @return ::std::size_t Number of layers
+     */
+    ::std::size_t layer_count() const noexcept { return layers; }
+
+    /**
+     * @brief Get the number of rows in each layer
+     *
+     * @return ::std::size_t Number of rows
+     */
+    ::std::size_t row_count() const noexcept { return rows; }
+
+    /**
+     * @brief Get the number of columns in each layer
+     *
+     * @return ::std::size_t Number of columns
+     */
+    ::std::size_t column_count() const noexcept { return columns; }
+
+    /**
+     * @brief Get the count of LEDs in all layers
+     *
+     * @return ::std::size_t Count of LEDs
+     */
+    ::std::size_t size() const noexcept
+    {
+        return chain.size() * rows * columns;
+    }
+
+    /**
+     * @brief Get a layer
+     *
+     * @param index Position of the layer in the chain
+     * @return const LedCubeLayer& Layer
+     */
+    const LedCubeLayer &layer(::std::size_t index) const noexcept
+    {
+        return chain[index];
+    }
+
+    /**
+     * @brief Retrieve the canonical index (in the canvas)
+     *        of the given pixel index (in the data wire)
+     *
+     * @note Computed on the fly. Use wireMap() instead
+     *       for the whole canvas.
+     *
+     * @param index Pixel index in the data wire
+     * @return ::std::size_t Canonical pixel index
+     */
+    ::std::size_t canonicalIndex(::std::size_t index) const noexcept;
+
+    /**
+     * @brief Build the wire map of this layout
+     *
+     * @note The canvas of the wire map has
+     *       `layer_count() * row_count()` rows and column_count() columns,
+     *       so it matches the storage of a PixelVolume.
+     *
+     * @return WireMap Canonical index of each LED in wire order.
+     *                 Empty if the canvas has more than
+     *                 WireMap::max_canvas_size pixels.
+     */
+    WireMap wireMap() const;
+
+private:
+    /// @brief Number of layers
+    ::std::size_t layers;
+    /// @brief Number of rows in each layer
+    ::std::size_t rows;
+    /// @brief Number of columns in each layer
+    ::std::size_t columns;
+    /// @brief Layers in chain order
+    ::std::vector<LedCubeLayer> chain;
+};
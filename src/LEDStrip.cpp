@@ -22,6 +22,7 @@
 
 #include <cassert>
 #include <cstring>               // Required to set/copy memory
+#include <algorithm>             // For std::min()
 #include "esp_log.h"             // For LOG_E()
 #include "driver/rmt_tx.h"       // For the RMT API
 #include "driver/gpio.h"         // For GPIO_IS_VALID... and others
@@ -81,11 +82,71 @@ private:
     /// @brief Nanoseconds per active wait loop
     static inline uint32_t ns_per_loop = 17;
 
+    /// @brief Scale factor applied to the current frame in the range [0,256]
+    /// @note Combines brightness and power limitation
+    uint16_t frame_factor = 256;
+    /// @brief Sum of red channel values in the current frame
+    uint32_t red_sum = 0;
+    /// @brief Sum of green channel values in the current frame
+    uint32_t green_sum = 0;
+    /// @brief Sum of blue channel values in the current frame
+    uint32_t blue_sum = 0;
+
+    /// @brief Channel sums of a block of wire pixels
+    struct BlockSums
+    {
+        uint16_t red = 0;
+        uint16_t green = 0;
+        uint16_t blue = 0;
+    };
+
+    /// @brief Wire pixels per block of channel sums (log2)
+    static constexpr size_t block_shift = 5;
+    /// @brief Channel sums of the current frame per block of wire pixels
+    /// @note Blocks not transmitted keep the sums of the previous frame
+    ::std::vector<BlockSums> block_sums;
+    /// @brief Pixels in the current frame
+    const PixelVector *frame = nullptr;
+    /// @brief Palette-indexed pixels in the current frame (overrides frame)
+    const PaletteVector *indexed_frame = nullptr;
+    /// @brief Planar pixels in the current frame (overrides frame)
+    const PlanarPixelVector *planar_frame = nullptr;
+    /// @brief Rotated pixels in the current frame (overrides frame)
+    const RotatedPixelVector *rotated_frame = nullptr;
+    /// @brief Viewport in the current frame (overrides frame)
+    const PixelViewport *viewport_frame = nullptr;
+    /// @brief Viewport reused by show(canvas, row, column, edge)
+    ::std::unique_ptr<PixelViewport> viewport;
+    /// @brief Pixels blended into the current frame (optional)
+    const PixelVector *crossfade_target = nullptr;
+    /// @brief Blend amount of the crossfade target
+    uint8_t crossfade_amount = 0;
+    /// @brief Last frame shown, if its changes are tracked
+    const PixelVector *last_frame = nullptr;
+    /// @brief Change generation of the last frame shown
+    uint32_t last_frame_generation = 0;
+    /// @brief Count of pixels in the last frame shown
+    size_t last_frame_size = 0;
+    /// @brief Scale factor applied to the last frame shown
+    uint16_t last_frame_factor = 0;
+    /// @brief Position of the encoder in the segment map
+    SegmentMap::Cursor segment_cursor;
+
 public:
     /// @brief Global brightness correction factor in the range [1,256]
     uint16_t brightness = 256;
     /// @brief Working parameters of the LED matrix
     LedMatrixParameters params;
+    /// @brief Precomputed wire map (overrides params if not empty)
+    WireMap wire_map;
+    /// @brief Run-length segment map (overrides params if not empty)
+    SegmentMap segment_map;
+    /// @brief Power budget
+    PowerBudget power_budget;
+    /// @brief Power limitation factor for the next frame in the range [0,256]
+    uint16_t power_scale = 256;
+    /// @brief Power statistics of the last frame
+    PowerStatistics power_statistics;
 
     /**
      * @brief Initialize the RMT hardware
@@ -184,7 +245,23 @@ public:
      *
      * @note This encoder is quite similar to the built-in byte encoder
      *
-     * @param data Pixel data in BGR format as stored in PixelVector
+     * @note Channel values are summed up in the same pass
+     *       for power limitation
+     *
+     * @note Pixels are blended with the crossfade target (if any)
+     *       in the same pass
+     *
+     * @note Pending rotations (see RotatedPixelVector)
+     *       are applied here
+     *
+     * @note Palette indices (see PaletteVector) are resolved here
+     *
+     * @note Pixel indices are mapped via the wire map or
+     *       the segment map, if any,
+     *       or via the LED matrix parameters, otherwise.
+     *       Skipped LEDs in the segment map are sent black.
+     *
+     * @param data Not used. Pixels are read from the current frame.
      * @param data_size Pixel data size in bytes
      * @param symbols_written Count of symbols previously written
      * @param symbols_free Count of symbols available in the transmit buffer
@@ -213,30 +290,49 @@ public:
         {
             LEDStrip::Implementation *instance =
                 static_cast<LEDMatrix::Implementation *>(arg);
-            const Pixel *pixel_ptr = static_cast<const Pixel *>(data);
             size_t previous_symbols_written = symbols_written;
             size_t pixelIndex = (symbols_written / symbols_per_pixel);
+            if (pixelIndex == 0)
+                instance->segment_cursor = SegmentMap::Cursor();
             while (
                 (symbols_free >= symbols_per_pixel) &&
                 (symbols_written < total_symbol_count))
             {
                 uint8_t byte[3];
-                size_t canonicalIndex =
-                    instance->params.canonicalIndex(pixelIndex);
+                size_t canonicalIndex;
+                bool shown = true;
+                if (!instance->wire_map.empty())
+                    canonicalIndex = instance->wire_map[pixelIndex];
+                else if (!instance->segment_map.empty())
+                    shown = instance->segment_map.next(
+                        instance->segment_cursor,
+                        canonicalIndex);
+                else
+                    canonicalIndex =
+                        instance->params.canonicalIndex(pixelIndex);
+                Pixel pixel;
+                if (shown)
+                    pixel = instance->framePixel(canonicalIndex);
+                if (shown && instance->crossfade_target)
+                    pixel.blend(
+                        (*instance->crossfade_target)[canonicalIndex],
+                        instance->crossfade_amount);
+                BlockSums &sums =
+                    instance->block_sums[pixelIndex >> block_shift];
+                sums.red += pixel.red;
+                sums.green += pixel.green;
+                sums.blue += pixel.blue;
                 byte[0] =
-                    (pixel_ptr[canonicalIndex]
-                         .byte0(instance->driver.pixelFormat) *
-                     instance->brightness) >>
+                    (pixel.byte0(instance->driver.pixelFormat) *
+                     instance->frame_factor) >>
                     8;
                 byte[1] =
-                    (pixel_ptr[canonicalIndex]
-                         .byte1(instance->driver.pixelFormat) *
-                     instance->brightness) >>
+                    (pixel.byte1(instance->driver.pixelFormat) *
+                     instance->frame_factor) >>
                     8;
                 byte[2] =
-                    (pixel_ptr[canonicalIndex]
-                         .byte2(instance->driver.pixelFormat) *
-                     instance->brightness) >>
+                    (pixel.byte2(instance->driver.pixelFormat) *
+                     instance->frame_factor) >>
                     8;
 
                 for (size_t byteIndex = 0; byteIndex < 3; byteIndex++)
@@ -335,24 +431,319 @@ public:
         return 0;
     } // shutdown_rmt_encoder()
 
-    void show(const PixelVector &pixels)
+    /**
+     * @brief Get a pixel from the current frame
+     *
+     * @note Pixels are read from indexed_frame, planar_frame,
+     *       rotated_frame or viewport_frame, if set,
+     *       or from frame, otherwise
+     *
+     * @param index Canonical pixel index
+     * @return Pixel Color of the pixel
+     */
+    Pixel framePixel(size_t index) const noexcept
+    {
+        if (indexed_frame)
+            return indexed_frame->color(index);
+        if (planar_frame)
+            return planar_frame->color(index);
+        if (rotated_frame)
+            return (*rotated_frame)[index];
+        if (viewport_frame)
+            return (*viewport_frame)[index];
+        return (*frame)[index];
+    } // framePixel()
+
+    /**
+     * @brief Transmit the current frame
+     *
+     * @note Pixels are read via framePixel()
+     *
+     * @param pixel_count Count of pixels
+     */
+    void transmit(size_t pixel_count)
     {
+        // Note: the power limitation computed in the previous frame
+        // is applied to this frame
+        frame_factor = nextFrameFactor();
+        size_t block_count = blockCount(pixel_count);
+        if (block_sums.size() < block_count)
+            block_sums.resize(block_count);
+        ::std::fill_n(block_sums.begin(), block_count, BlockSums());
         ESP_ERROR_CHECK(
             rmt_transmit(
                 rmtHandle,
                 pixel_encoder_handle,
-                pixels.data(),
-                pixels.size() * sizeof(Pixel),
+                this, // Note: not used
+                pixel_count * sizeof(Pixel),
                 &rmt_transmit_config));
         ESP_ERROR_CHECK(
             rmt_tx_wait_all_done(
                 rmtHandle,
                 -1));
         active_wait_ns(driver.restTime.count());
+    } // transmit()
+
+    /**
+     * @brief Transmit the current frame and update power statistics
+     *
+     * @note If the frame exceeds the power budget, it is transmitted
+     *       again with the new power limitation, so it does not stay
+     *       on the LEDs unscaled until the next frame.
+     *       There is no extra transmission within budget.
+     *
+     * @param pixel_count Count of pixels to transmit
+     * @param led_count Count of LEDs in the frame
+     */
+    void transmitFrame(size_t pixel_count, size_t led_count)
+    {
+        transmit(pixel_count);
+        updatePowerStatistics(led_count);
+        if (nextFrameFactor() < frame_factor)
+        {
+            transmit(led_count);
+            updatePowerStatistics(led_count);
+        }
+    }
+
+    /**
+     * @brief Count of blocks of channel sums covering some wire pixels
+     *
+     * @param pixel_count Count of wire pixels
+     * @return size_t Count of blocks
+     */
+    static inline size_t blockCount(size_t pixel_count) noexcept
+    {
+        return (pixel_count + (1 << block_shift) - 1) >> block_shift;
+    }
+
+    /**
+     * @brief Scale factor to be applied to the next frame
+     *
+     * @return uint16_t Scale factor in the range [0,256]
+     */
+    inline uint16_t nextFrameFactor() const noexcept
+    {
+        return (brightness * power_scale) >> 8;
+    }
+
+    /**
+     * @brief Count of LEDs to transmit for a frame
+     *
+     * @param pixel_count Count of pixels in the frame
+     * @return size_t Count of LEDs in the wire map or the segment map,
+     *         if any, or @p pixel_count, otherwise
+     */
+    size_t wireCount(size_t pixel_count) const noexcept
+    {
+        if (!wire_map.empty())
+        {
+            assert(pixel_count >= wire_map.canvasSize());
+            return wire_map.size();
+        }
+        if (!segment_map.empty())
+        {
+            assert(pixel_count >= segment_map.pixelCount());
+            return segment_map.ledCount();
+        }
+        return pixel_count;
+    }
+
+    /**
+     * @brief Count of pixels to transmit so all dirty pixels are shown
+     *
+     * @note Pixels past the last dirty one in wire order
+     *       keep their colors, so they are not transmitted
+     *
+     * @param first First dirty pixel (canonical index)
+     * @param last Last dirty pixel (canonical index)
+     * @param pixel_count Count of pixels in the frame
+     * @return size_t Count of pixels to transmit
+     */
+    size_t dirtyWireCount(
+        size_t first,
+        size_t last,
+        size_t pixel_count) const noexcept
+    {
+        if ((pixel_count != params.size()) ||
+            (params.column_count == 0) ||
+            !wire_map.empty() ||
+            !segment_map.empty())
+            return pixel_count;
+        size_t first_row = first / params.column_count;
+        size_t last_row = last / params.column_count;
+        size_t max_index = 0;
+        for (size_t row = first_row; row <= last_row; row++)
+        {
+            // Note: wire indices are monotonic within a row
+            size_t first_col =
+                (row == first_row) ? (first % params.column_count) : 0;
+            size_t last_col =
+                (row == last_row)
+                    ? (last % params.column_count)
+                    : (params.column_count - 1);
+            max_index = ::std::max(
+                {max_index,
+                 params.coordinatesToIndex(row, first_col),
+                 params.coordinatesToIndex(row, last_col)});
+        }
+        return max_index + 1;
+    }
+
+    void show(const PixelVector &pixels)
+    {
+        size_t led_count = wireCount(pixels.size());
+        size_t pixel_count = led_count;
+        if (pixels.tracksChanges() &&
+            (&pixels == last_frame) &&
+            (pixels.size() == last_frame_size) &&
+            (nextFrameFactor() == last_frame_factor))
+        {
+            size_t first, last;
+            if (!pixels.dirtyRange(last_frame_generation, first, last))
+                return; // Nothing changed since this strip showed it
+            // Note: whole blocks are transmitted, so the channel sums
+            // of the remaining blocks are still valid
+            pixel_count =
+                blockCount(dirtyWireCount(first, last, pixel_count))
+                << block_shift;
+            pixel_count = ::std::min(pixel_count, led_count);
+        }
+        frame = &pixels;
+        transmitFrame(pixel_count, led_count);
+        if (pixels.tracksChanges())
+        {
+            last_frame = &pixels;
+            last_frame_generation = pixels.generation();
+            last_frame_size = pixels.size();
+            last_frame_factor = frame_factor;
+        }
+        else
+            last_frame = nullptr;
+    } // show()
+
+    void show(const PixelVector &from, const PixelVector &to, uint8_t amount)
+    {
+        size_t pixel_count = wireCount(::std::min(from.size(), to.size()));
+        frame = &from;
+        crossfade_target = &to;
+        crossfade_amount = amount;
+        transmitFrame(pixel_count, pixel_count);
+        crossfade_target = nullptr;
+        last_frame = nullptr;
+    } // show()
+
+    void show(const PaletteVector &pixels)
+    {
+        size_t led_count = wireCount(pixels.size());
+        indexed_frame = &pixels;
+        transmitFrame(led_count, led_count);
+        indexed_frame = nullptr;
+        last_frame = nullptr;
+    } // show()
+
+    void show(const PlanarPixelVector &pixels)
+    {
+        size_t led_count = wireCount(pixels.size());
+        planar_frame = &pixels;
+        transmitFrame(led_count, led_count);
+        planar_frame = nullptr;
+        last_frame = nullptr;
+    } // show()
+
+    void show(const RotatedPixelVector &pixels)
+    {
+        size_t led_count = wireCount(pixels.size());
+        rotated_frame = &pixels;
+        transmitFrame(led_count, led_count);
+        rotated_frame = nullptr;
+        last_frame = nullptr;
+    } // show()
+
+    void show(const PixelViewport &pixels)
+    {
+        size_t led_count = wireCount(pixels.size());
+        viewport_frame = &pixels;
+        transmitFrame(led_count, led_count);
+        viewport_frame = nullptr;
+        last_frame = nullptr;
     } // show()
 
+    void show(
+        const PixelMatrix &canvas,
+        ::std::ptrdiff_t row,
+        ::std::ptrdiff_t column,
+        ViewportEdge edge)
+    {
+        size_t row_count = params.row_count;
+        size_t column_count = params.column_count;
+        if (!wire_map.empty())
+        {
+            row_count = wire_map.row_count;
+            column_count = wire_map.column_count;
+        }
+        // Note: the viewport is created again only if its size changes
+        if (!viewport ||
+            (viewport->row_count() != row_count) ||
+            (viewport->column_count() != column_count) ||
+            (viewport->edge() != edge))
+            viewport = ::std::make_unique<PixelViewport>(
+                canvas,
+                row_count,
+                column_count,
+                edge);
+        else if (&viewport->canvas() != &canvas)
+            viewport->canvas(canvas);
+        viewport->moveTo(row, column);
+        show(*viewport);
+    } // show()
+
+    /**
+     * @brief Estimate the power draw of the last frame
+     *        and compute the power limitation for the next one
+     *
+     * @param pixel_count Number of pixels in the last frame
+     */
+    void updatePowerStatistics(size_t pixel_count) noexcept
+    {
+        // Note: O(blocks), not O(pixels)
+        red_sum = 0;
+        green_sum = 0;
+        blue_sum = 0;
+        size_t block_count =
+            ::std::min(blockCount(pixel_count), block_sums.size());
+        for (size_t block = 0; block < block_count; block++)
+        {
+            red_sum += block_sums[block].red;
+            green_sum += block_sums[block].green;
+            blue_sum += block_sums[block].blue;
+        }
+        power_statistics.requested_milliamps =
+            power_budget.milliamps(
+                red_sum,
+                green_sum,
+                blue_sum,
+                pixel_count,
+                brightness);
+        power_statistics.milliamps =
+            power_budget.milliamps(
+                red_sum,
+                green_sum,
+                blue_sum,
+                pixel_count,
+                frame_factor);
+        power_statistics.milliwatts =
+            power_statistics.milliamps * power_budget.volts;
+        power_statistics.scale = (power_scale > 255) ? 255 : power_scale;
+        power_scale =
+            power_budget.scale(
+                power_statistics.requested_milliamps,
+                pixel_count);
+    } // updatePowerStatistics()
+
     void shutdown()
     {
+        last_frame = nullptr;
         rmt_simple_encoder_config_t cfg{
             .callback = shutdown_rmt_encoder,
             .arg = (void *)this,
@@ -369,7 +760,7 @@ public:
                     rmtHandle,
                     shutdown_encoder_handle,
                     &cfg, // Note: not used
-                    params.size() * sizeof(Pixel),
+                    ledCount() * sizeof(Pixel),
                     &rmt_transmit_config));
             ESP_ERROR_CHECK(
                 rmt_tx_wait_all_done(
@@ -385,6 +776,63 @@ public:
         return driver;
     }
 
+    /**
+     * @brief Count of LEDs attached to the data wire
+     *
+     * @return size_t Count of LEDs
+     */
+    inline size_t ledCount() const noexcept
+    {
+        if (!wire_map.empty())
+            return wire_map.size();
+        if (!segment_map.empty())
+            return segment_map.ledCount();
+        return params.size();
+    }
+
+    void wireMap(const WireMap &map)
+    {
+#ifndef NDEBUG
+        for (WireMap::index_type canonical : map)
+            assert(canonical < map.canvasSize());
+#endif
+        wire_map = map;
+        segment_map.clear();
+        last_frame = nullptr;
+    }
+
+    bool parameters(const LedMatrixParameters &new_params)
+    {
+        if (new_params.size() != params.size())
+        {
+            ESP_LOGE(
+                LOG_TAG,
+                "New LED matrix parameters have %u pixels instead of %u",
+                (unsigned int)new_params.size(),
+                (unsigned int)params.size());
+            return false;
+        }
+        params = new_params;
+        wire_map.clear();
+        segment_map.clear();
+        last_frame = nullptr;
+        return true;
+    }
+
+    void wireMap(const TiledLayout &layout, size_t panel_index)
+    {
+        assert(wire_map.size() == layout.size());
+        layout.wireMap(wire_map, panel_index);
+        last_frame = nullptr;
+    }
+
+    void segmentMap(const SegmentMap &map)
+    {
+        segment_map = map;
+        wire_map.clear();
+        last_frame = nullptr;
+    }
+
     inline void move(Implementation &&source) noexcept
     {
         rmtHandle = source.rmtHandle;
@@ -392,6 +840,11 @@ public:
         byte_enc_config = source.byte_enc_config;
         driver = source.driver;
         params = source.params;
+        wire_map = ::std::move(source.wire_map);
+        segment_map = ::std::move(source.segment_map);
+        power_budget = source.power_budget;
+        power_scale = source.power_scale;
+        last_frame = nullptr;
         source.rmtHandle = nullptr;
         source.pixel_encoder_handle = nullptr;
     }
@@ -495,6 +948,70 @@ void LEDStrip::show(const PixelVector &pixels)
     _impl->show(pixels);
 }
 
+void LEDStrip::show(
+    const PixelVector &from,
+    const PixelVector &to,
+    uint8_t amount)
+{
+    _impl->show(from, to, amount);
+}
+
+void LEDStrip::show(const PaletteVector &pixels)
+{
+    _impl->show(pixels);
+}
+
+void LEDStrip::show(const PlanarPixelVector &pixels)
+{
+    _impl->show(pixels);
+}
+
+void LEDStrip::show(const RotatedPixelVector &pixels)
+{
+    _impl->show(pixels);
+}
+
+void LEDStrip::show(const PixelViewport &viewport)
+{
+    _impl->show(viewport);
+}
+
+void LEDStrip::show(
+    const PixelMatrix &canvas,
+    ::std::ptrdiff_t row,
+    ::std::ptrdiff_t column,
+    ViewportEdge edge)
+{
+    _impl->show(canvas, row, column, edge);
+}
+
+void LEDStrip::wireMap(const WireMap &map)
+{
+    _impl->wireMap(map);
+}
+
+const WireMap &LEDStrip::wireMap() const noexcept
+{
+    return _impl->wire_map;
+}
+
+void LEDStrip::wireMap(
+    const TiledLayout &layout,
+    ::std::size_t panel_index)
+{
+    _impl->wireMap(layout, panel_index);
+}
+
+void LEDStrip::segmentMap(const SegmentMap &map)
+{
+    _impl->segmentMap(map);
+}
+
+const SegmentMap &LEDStrip::segmentMap() const noexcept
+{
+    return _impl->segment_map;
+}
+
 void LEDStrip::shutdown()
 {
     _impl->shutdown();
@@ -522,6 +1039,27 @@ const LedMatrixParameters &LEDMatrix::parameters() const noexcept
     return _impl->params;
 }
 
+bool LEDStrip::parameters(const LedMatrixParameters &params)
+{
+    return _impl->parameters(params);
+}
+
+PowerBudget LEDStrip::powerBudget() const noexcept
+{
+    return _impl->power_budget;
+}
+
+void LEDStrip::powerBudget(const PowerBudget &budget) noexcept
+{
+    _impl->power_budget = budget;
+    _impl->power_scale = 256;
+}
+
+PowerStatistics LEDStrip::powerStatistics() const noexcept
+{
+    return _impl->power_statistics;
+}
+
 void LEDStrip::syncWithCPUFrequency()
 {
     LEDStrip::Implementation::syncWithCPUFrequency();
@@ -529,6 +1067,11 @@ void LEDStrip::syncWithCPUFrequency()
 
 PixelMatrix LEDMatrix::pixelMatrix(const Pixel &color) const noexcept
 {
+    if (!_impl->wire_map.empty())
+        return PixelMatrix(
+            _impl->wire_map.row_count,
+            _impl->wire_map.column_count,
+            color);
     PixelMatrix result(
         _impl->params.row_count,
         _impl->params.column_count,
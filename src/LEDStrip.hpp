@@ -14,6 +14,14 @@
 //------------------------------------------------------------------------------
 
 #include "RgbLedController.hpp"
+#include "PaletteVector.hpp"
+#include "PlanarPixelVector.hpp"
+#include "TiledLayout.hpp"
+#include "PointLayout.hpp"
+#include "SegmentMap.hpp"
+#include "PixelVolume.hpp"
+#include "PixelViewport.hpp"
+#include "RotatedPixelVector.hpp"
 #include <memory> // For ::std::unique_ptr
 
 #ifdef CD_CI
@@ -86,8 +94,113 @@ public:
     LEDStrip(const LEDStrip &) = delete;
     LEDStrip &operator=(const LEDStrip &) = delete;
 
+    /**
+     * @brief Display pixels (all at once) ignoring display priority
+     *
+     * @note Thread-safe. Ignores any display guard.
+     *
+     * @note If @p pixels tracks changes (see PixelVector::trackChanges()),
+     *       this LED strip remembers the last generation it has shown.
+     *       Nothing is transmitted if there are no changes since then,
+     *       and transmission stops after the last modified pixel.
+     *       Writes through PixelVector::operator[]() or
+     *       PixelMatrix::operator()() are not tracked:
+     *       call PixelVector::markDirty() afterwards.
+     *
+     * @param pixels Pixel vector
+     */
     virtual void show(const PixelVector &pixels) override;
 
+    /**
+     * @brief Display a crossfade between two vectors of pixels
+     *
+     * @note Pixels are blended while being transmitted,
+     *       so the blended frame is never stored.
+     *       The result is the same as showing
+     *       PixelVector::crossfade(from, to, amount).
+     *
+     * @note Only the first min(from.size(),to.size()) pixels are shown
+     *
+     * @param from Pixels at the start of the transition
+     * @param to Pixels at the end of the transition
+     * @param amount Transition amount.
+     *               0 will show @p from.
+     *               255 will show @p to.
+     */
+    void show(const PixelVector &from, const PixelVector &to, uint8_t amount);
+
+    /**
+     * @brief Display palette-indexed pixels
+     *
+     * @note Palette indices are resolved while being transmitted,
+     *       so the frame takes a third of the memory of a PixelVector.
+     *
+     * @note Display guards are not involved
+     *
+     * @param pixels Pixels to show
+     */
+    void show(const PaletteVector &pixels);
+
+    /**
+     * @brief Display planar pixels
+     *
+     * @note Color planes are interleaved while being transmitted,
+     *       so there is no need to convert them into a PixelVector.
+     *
+     * @note Display guards are not involved
+     *
+     * @param pixels Pixels to show
+     */
+    void show(const PlanarPixelVector &pixels);
+
+    /**
+     * @brief Display rotated pixels
+     *
+     * @note The rotation is applied while being transmitted,
+     *       so the pixels are not moved in memory.
+     *
+     * @note Display guards are not involved
+     *
+     * @param pixels Rotated view of the pixels to show
+     */
+    void show(const RotatedPixelVector &pixels);
+
+    /**
+     * @brief Display a window into a larger canvas
+     *
+     * @note Pixels are read from the canvas while being transmitted,
+     *       so there is no intermediate copy.
+     *
+     * @note The viewport must have the size of this LED matrix
+     *       (or the canvas of the installed wire map)
+     *
+     * @note Display guards are not involved
+     *
+     * @param viewport Window into a canvas
+     */
+    void show(const PixelViewport &viewport);
+
+    /**
+     * @brief Display a window into a larger canvas
+     *
+     * @note The window has the size of this LED matrix
+     *       (or the canvas of the installed wire map).
+     *       Pixels are read from the canvas while being transmitted,
+     *       so panning costs nothing.
+     *
+     * @note Display guards are not involved
+     *
+     * @param canvas Pixel matrix. Must not be empty.
+     * @param row Canvas row of the top-left pixel (may be negative)
+     * @param column Canvas column of the top-left pixel (may be negative)
+     * @param edge Behavior beyond the edges of the canvas
+     */
+    void show(
+        const PixelMatrix &canvas,
+        ::std::ptrdiff_t row,
+        ::std::ptrdiff_t column,
+        ViewportEdge edge = ViewportEdge::wrap);
+
     /**
      * @brief Turn all LEDs off
      *
@@ -116,6 +229,38 @@ public:
      */
     virtual uint8_t brightness(uint8_t value);
 
+    /**
+     * @brief Get the power budget
+     *
+     * @note Defaults to no power limitation
+     *
+     * @return PowerBudget Current power budget
+     */
+    PowerBudget powerBudget() const noexcept;
+
+    /**
+     * @brief Set the power budget
+     *
+     * @note Channel values are summed up while pixels are transmitted,
+     *       so there is no additional pass over the pixel vector.
+     *       If a frame exceeds the budget, it is transmitted again
+     *       right away, scaled down to meet it. Following frames
+     *       keep that scale factor while they exceed the budget.
+     *
+     * @param budget New power budget.
+     *               Set PowerBudget::max_milliamps to zero to
+     *               disable power limitation.
+     */
+    void powerBudget(const PowerBudget &budget) noexcept;
+
+    /**
+     * @brief Get power statistics of the last displayed frame
+     *
+     * @return PowerStatistics Estimated power draw and
+     *                         applied scale factor
+     */
+    PowerStatistics powerStatistics() const noexcept;
+
     /**
      * @brief Get the configured pixel driver
      *
@@ -142,9 +287,100 @@ public:
      */
     const LedMatrixParameters &parameters() const noexcept;
 
+    /**
+     * @brief Change the working parameters of a live LED matrix
+     *
+     * @note Takes effect in the next frame.
+     *       The RMT channel is not initialized again.
+     *       Use it to change the orientation of a mounted matrix
+     *       (see LedMatrixParameters::flipVertical(),
+     *       LedMatrixParameters::flipHorizontal() and
+     *       LedMatrixParameters::rotate90clockwise()).
+     *       The next frame is fully transmitted.
+     *
+     * @note The last mapping installed wins: this method removes
+     *       the wire map and the segment map, if any.
+     *
+     * @param params New working parameters. Must have the same
+     *               count of pixels.
+     * @return true On success
+     * @return false If the count of pixels differs. Nothing changes.
+     */
+    bool parameters(const LedMatrixParameters &params);
+
+    /**
+     * @brief Install a precomputed wire map
+     *
+     * @note Once installed, frames are canvases
+     *       (see WireMap::row_count and WireMap::column_count)
+     *       and the i-th LED shows the canvas pixel
+     *       at canonical index `map[i]`.
+     *       The working parameters are ignored until
+     *       parameters() is called again.
+     *
+     * @note Shown frames must have, at least,
+     *       as many pixels as the canvas.
+     *
+     * @note Removes the segment map, if any
+     *
+     * @param map Wire map (copied). Pass an empty wire map to
+     *            go back to the working parameters.
+     */
+    void wireMap(const WireMap &map);
+
+    /**
+     * @brief Get the installed wire map
+     *
+     * @return const WireMap& Wire map. Empty if not installed.
+     */
+    const WireMap &wireMap() const noexcept;
+
+    /**
+     * @brief Update the installed wire map after a panel
+     *        changed its orientation
+     *
+     * @note Only the entries of that panel are rebuilt
+     *       (see TiledLayout::panelParameters()).
+     *       Takes effect in the next frame.
+     *
+     * @param layout Layout whose wire map is installed
+     * @param panel_index Position of the changed panel in the chain
+     */
+    void wireMap(const TiledLayout &layout, ::std::size_t panel_index);
+
+    /**
+     * @brief Install a run-length segment map
+     *
+     * @note Once installed, the LED strip has
+     *       SegmentMap::ledCount() LEDs. Each run shows
+     *       consecutive pixels, maybe in reverse order,
+     *       and skipped LEDs are sent black.
+     *       The working parameters are ignored until
+     *       parameters() is called again.
+     *
+     * @note Shown frames must have, at least,
+     *       SegmentMap::pixelCount() pixels.
+     *
+     * @note Removes the wire map, if any
+     *
+     * @param map Segment map (copied). Pass an empty segment map to
+     *            go back to the working parameters.
+     */
+    void segmentMap(const SegmentMap &map);
+
+    /**
+     * @brief Get the installed segment map
+     *
+     * @return const SegmentMap& Segment map. Empty if not installed.
+     */
+    const SegmentMap &segmentMap() const noexcept;
+
     /**
      * @brief Retrieve a suitable pixel matrix for this LED strip
      *
+     * @note If a wire map is installed, the pixel matrix
+     *       has the size of its canvas
+     *
      * @param color Initial color for all pixels
      * @return PixelMatrix Pixel matrix object
      */
@@ -0,0 +1,67 @@
+/**
+ * @file PaletteVector.cpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Palette-indexed vectors of pixels
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 License
+ */
+
+#include "PaletteVector.hpp"
+#include <algorithm> // For ::std::rotate() and ::std::fill()
+#include <cstring>   // For ::std::memset()
+
+//------------------------------------------------------------------------------
+// Palette
+//------------------------------------------------------------------------------
+
+void PaletteVector::palette(const PixelVector &colors) noexcept
+{
+    assert((colors.size() == 16) || (colors.size() == 256));
+    this->colors = colors;
+    mask = this->colors.size() - 1;
+}
+
+void PaletteVector::rotatePalette(
+    ::std::ptrdiff_t count,
+    uint8_t first,
+    uint8_t last) noexcept
+{
+    if (first > last)
+        ::std::swap(first, last);
+    if (last > mask)
+        last = mask;
+    if (first >= last)
+        return;
+    ::std::ptrdiff_t n = last - first + 1;
+    count %= n;
+    if (count < 0)
+        count += n;
+    if (count == 0)
+        return;
+    auto begin = colors.begin() + first;
+    ::std::rotate(begin, begin + (n - count), begin + n);
+}
+
+//------------------------------------------------------------------------------
+// Pixels
+//------------------------------------------------------------------------------
+
+void PaletteVector::fill(uint8_t index) noexcept
+{
+    if (size())
+        ::std::memset(data(), index, size());
+}
+
+void PaletteVector::toPixels(PixelVector &pixels) const
+{
+    pixels.resize(size());
+    const uint8_t *index = data();
+    const Pixel *palette_colors = colors.data();
+    Pixel *pixel = pixels.data();
+    for (size_type i = 0; i < size(); i++)
+        pixel[i] = palette_colors[index[i] & mask];
+    pixels.markDirty();
+}
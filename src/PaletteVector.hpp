@@ -0,0 +1,133 @@
+/**
+ * @file PaletteVector.hpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Palette-indexed vectors of pixels
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 License
+ */
+
+#pragma once
+
+//------------------------------------------------------------------------------
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cassert>
+#include "PixelVector.hpp"
+
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Vector of palette indices (one byte per pixel)
+ *
+ * @note Each element is an index into a palette of 16 or 256 colors.
+ *       Takes a third of the memory of a PixelVector.
+ *       Indices are taken modulo the palette size.
+ */
+struct PaletteVector : public ::std::vector<uint8_t>
+{
+public:
+    /// @brief Size type of this vector
+    using size_type = typename ::std::vector<uint8_t>::size_type;
+
+    /// @brief Inherited constructors (256 black colors in the palette)
+    using ::std::vector<uint8_t>::vector;
+
+    /**
+     * @brief Get the color of a pixel
+     *
+     * @note No bounds checking
+     *
+     * @param index Pixel index
+     * @return Pixel Palette color of the pixel at @p index
+     */
+    Pixel color(size_type index) const noexcept
+    {
+        return colors.data()[data()[index] & mask];
+    }
+
+    /**
+     * @brief Get the palette
+     *
+     * @return const PixelVector& Palette colors
+     */
+    const PixelVector &palette() const noexcept { return colors; }
+
+    /**
+     * @brief Replace the palette
+     *
+     * @param colors Palette colors. Must have 16 or 256 colors.
+     */
+    void palette(const PixelVector &colors) noexcept;
+
+    /**
+     * @brief Get the palette size
+     *
+     * @return size_type 16 or 256
+     */
+    size_type paletteSize() const noexcept { return colors.size(); }
+
+    /**
+     * @brief Get a palette color
+     *
+     * @param index Palette index (taken modulo the palette size)
+     * @return Pixel& Palette color
+     */
+    Pixel &paletteColor(uint8_t index) noexcept
+    {
+        return colors[index & mask];
+    }
+
+    /**
+     * @brief Get a palette color
+     *
+     * @param index Palette index (taken modulo the palette size)
+     * @return const Pixel& Palette color
+     */
+    const Pixel &paletteColor(uint8_t index) const noexcept
+    {
+        return colors[index & mask];
+    }
+
+    /**
+     * @brief Rotate a range of palette colors (color cycling)
+     *
+     * @note The cost depends on the palette size,
+     *       not on the count of pixels.
+     *
+     * @param count Rotation count. Positive values move each color
+     *              to a higher palette index (the last color in the
+     *              range moves to the first index).
+     *              Negative values rotate the other way.
+     * @param first First palette index in the range (inclusive)
+     * @param last Last palette index in the range (inclusive)
+     */
+    void rotatePalette(
+        ::std::ptrdiff_t count,
+        uint8_t first = 0,
+        uint8_t last = 255) noexcept;
+
+    /**
+     * @brief Fill the entire vector with a palette index
+     *
+     * @param index Palette index
+     */
+    void fill(uint8_t index) noexcept;
+
+    /**
+     * @brief Resolve all palette indices into colors
+     *
+     * @param pixels Destination. Resized to the size of this vector.
+     */
+    void toPixels(PixelVector &pixels) const;
+
+private:
+    /// @brief Palette colors
+    PixelVector colors = PixelVector(256);
+    /// @brief Palette size minus one
+    uint8_t mask = 255;
+};
@@ -12,14 +12,52 @@
 //------------------------------------------------------------------------------
 
 #include "Pixel.hpp"
+#include "PixelMath.hpp"
 #include <cassert>
-#include <cmath>
+#include <algorithm>
 
 #if CD_CI
 // For debugging
 #include <iostream>
 #endif
 
+//------------------------------------------------------------------------------
+// Hue sector lookup table
+//------------------------------------------------------------------------------
+
+/// @brief Reciprocal of 60 in 22-bit fixed point (rounded up)
+/// @note `(n * inverse60) >> 22 == n / 60` for any n below 74900
+static constexpr uint32_t inverse60 = ((1UL << 22) / 60) + 1;
+
+/**
+ * @brief Hue sector of every hue degree and its distance
+ *        to the nearest primary or secondary color
+ *
+ * @note Each entry holds the hue sector in the upper byte
+ *       and the (mirrored) remainder in degrees in the lower byte,
+ *       so Pixel::hsl() needs no division.
+ */
+struct HueSectorTable
+{
+    /// @brief One entry per degree
+    uint16_t entry[360];
+
+    constexpr HueSectorTable() noexcept : entry{}
+    {
+        for (unsigned int hue = 0; hue < 360; hue++)
+        {
+            unsigned int sector = hue / 60;
+            unsigned int remainder = hue - (sector * 60);
+            if (sector & 1)
+                remainder = 60 - remainder;
+            entry[hue] = (sector << 8) | remainder;
+        }
+    }
+};
+
+/// @brief Computed at compile time and stored in flash memory
+static constexpr HueSectorTable hue_sectors;
+
 //------------------------------------------------------------------------------
 
 uint8_t Pixel::min() const noexcept
@@ -76,52 +114,36 @@ void Pixel::hsl(
     uint8_t luminance) noexcept
 {
     assert((hue < 360) && "Hue value not in the [0,360) range");
-    int c_255 = ((255 - ::std::abs((2 * luminance) - 255)) * saturation) / 254;
-    // ::std::cout << "C= " << c_255 << ::std::endl;
-    double x_aux =
-        ::std::abs(::std::fmod((double)hue / 60.0, (double)2.0) - 1.0);
-    // ::std::cout << "X_aux= " << x_aux << ::std::endl;
-    int x_255 = c_255 * (10000 - (int)(x_aux * 10000)) / 10000;
-    // ::std::cout << "X= " << x_255 << ::std::endl;
-    int m_255 = luminance - (c_255 / 2);
-    // ::std::cout << "M= " << m_255 << ::std::endl;
-
-    if (hue >= 300)
-    {
-        red = c_255 + m_255;
-        green = m_255;
-        blue = x_255 + m_255;
-    }
-    else if (hue >= 240)
-    {
-        red = x_255 + m_255;
-        green = m_255;
-        blue = c_255 + m_255;
-    }
-    else if (hue >= 180)
-    {
-        red = 0 + m_255;
-        green = x_255 + m_255;
-        blue = c_255 + m_255;
-    }
-    else if (hue >= 120)
-    {
-        red = m_255;
-        green = c_255 + m_255;
-        blue = x_255 + m_255;
-    }
-    else if (hue >= 60)
-    {
-        red = x_255 + m_255;
-        green = c_255 + m_255;
-        blue = m_255;
-    }
-    else
-    {
-        red = c_255 + m_255;
-        green = x_255 + m_255;
-        blue = m_255;
-    }
+    PixelMath::HslTerms terms = PixelMath::hslTerms(saturation, luminance);
+    uint32_t entry = hue_sectors.entry[hue];
+    uint32_t remainder = entry & 0xFF;
+    PixelMath::hslAssign(
+        *this,
+        entry >> 8,
+        (terms.chroma * remainder * inverse60) >> 22,
+        terms);
+}
+
+void Pixel::hsl8(
+    uint8_t hue,
+    uint8_t saturation,
+    uint8_t luminance) noexcept
+{
+    PixelMath::hsl16(
+        *this,
+        hue << 8,
+        PixelMath::hslTerms(saturation, luminance));
+}
+
+void Pixel::hsl16(
+    uint16_t hue,
+    uint8_t saturation,
+    uint8_t luminance) noexcept
+{
+    PixelMath::hsl16(
+        *this,
+        hue,
+        PixelMath::hslTerms(saturation, luminance));
 }
 
 uint8_t Pixel::byte0(PixelFormat format) const noexcept
@@ -191,3 +213,12 @@ void Pixel::dim(uint8_t brightness_factor) noexcept
     green = (green * b) >> 8;
     blue = (blue * b) >> 8;
 }
+
+void Pixel::blend(const Pixel &other, uint8_t amount) noexcept
+{
+    uint16_t w = PixelMath::blendWeight(amount);
+    uint16_t v = 256 - w;
+    red = ((red * v) + (other.red * w)) >> 8;
+    green = ((green * v) + (other.green * w)) >> 8;
+    blue = ((blue * v) + (other.blue * w)) >> 8;
+}
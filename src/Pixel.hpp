@@ -75,8 +75,40 @@ struct Pixel
      */
     unsigned int hue() const noexcept;
 
+    /**
+     * @brief Set the pixel color in the HSL model
+     *
+     * @note Integer arithmetic only. The hue sector is taken from
+     *       a lookup table, so no division is required.
+     *
+     * @param hue Hue in degrees [0,359]
+     * @param saturation Saturation in the range [0,255]
+     * @param luminance Luminance in the range [0,255]
+     */
     void hsl(unsigned int hue, uint8_t saturation, uint8_t luminance) noexcept;
 
+    /**
+     * @brief Set the pixel color in the HSL model using an 8-bit hue
+     *
+     * @note Fixed-point arithmetic only
+     *
+     * @param hue Hue where 256 units are 360 degrees
+     * @param saturation Saturation in the range [0,255]
+     * @param luminance Luminance in the range [0,255]
+     */
+    void hsl8(uint8_t hue, uint8_t saturation, uint8_t luminance) noexcept;
+
+    /**
+     * @brief Set the pixel color in the HSL model using a 16-bit hue
+     *
+     * @note Fixed-point arithmetic only
+     *
+     * @param hue Hue where 65536 units are 360 degrees
+     * @param saturation Saturation in the range [0,255]
+     * @param luminance Luminance in the range [0,255]
+     */
+    void hsl16(uint16_t hue, uint8_t saturation, uint8_t luminance) noexcept;
+
 public:
     /**
      * @brief Convert to packed RGB format
@@ -261,6 +293,18 @@ public:
      *                          0 will reduce brightness to black.
      */
     void dim(uint8_t brightness_factor) noexcept;
+
+    /**
+     * @brief Blend with another pixel
+     *
+     * @note Fixed-point linear interpolation. No division is required.
+     *
+     * @param other Pixel to blend with
+     * @param amount Blend amount.
+     *               0 will keep this pixel unchanged.
+     *               255 will copy @p other into this pixel.
+     */
+    void blend(const Pixel &other, uint8_t amount) noexcept;
 };
 
 static_assert(sizeof(Pixel) == 3);
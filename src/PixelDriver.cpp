@@ -17,208 +17,35 @@
 #include "PixelDriver.hpp"
 #include <cassert>
 
-#define INV(size, value) (((size) - 1) - (value))
-
 //------------------------------------------------------------------------------
-// LedMatrixParameters
+// PowerBudget
 //------------------------------------------------------------------------------
 
-void LedMatrixParameters::indexToCoordinates(
-    ::std::size_t index,
-    ::std::size_t &row,
-    ::std::size_t &col) const noexcept
-{
-    assert(index < (row_count * column_count));
-    if (arrangement == LedMatrixArrangement::rows)
-    {
-        row = (index / column_count);
-        col = (index % column_count);
-        bool reverse =
-            (row % 2) && (wiring == LedMatrixWiring::serpentine);
-
-        if (((first_pixel == LedMatrixFirstPixel::top_right) ||
-             (first_pixel == LedMatrixFirstPixel::bottom_right)) ^
-            reverse)
-            col = INV(column_count, col);
-        if ((first_pixel == LedMatrixFirstPixel::bottom_left) ||
-            (first_pixel == LedMatrixFirstPixel::bottom_right))
-            row = INV(row_count, row);
-    }
-    else // (arrangement == LedMatrixArrangement::columns)
-    {
-        col = (index / row_count);
-        row = (index % row_count);
-        bool reverse =
-            (col % 2) && (wiring == LedMatrixWiring::serpentine);
-
-        if (((first_pixel == LedMatrixFirstPixel::bottom_left) ||
-             (first_pixel == LedMatrixFirstPixel::bottom_right)) ^
-            reverse)
-            row = INV(row_count, row);
-        if ((first_pixel == LedMatrixFirstPixel::top_right) ||
-            (first_pixel == LedMatrixFirstPixel::bottom_right))
-            col = INV(column_count, col);
-    }
-}
-
-::std::size_t LedMatrixParameters::coordinatesToIndex(
-    ::std::size_t row,
-    ::std::size_t col) const noexcept
+::std::uint32_t PowerBudget::milliamps(
+    ::std::uint32_t red_sum,
+    ::std::uint32_t green_sum,
+    ::std::uint32_t blue_sum,
+    ::std::size_t pixel_count,
+    ::std::uint16_t factor) const noexcept
 {
-    assert(row < row_count);
-    assert(col < column_count);
-
-    switch (first_pixel)
-    {
-    case LedMatrixFirstPixel::top_left:
-    {
-        if (arrangement == LedMatrixArrangement::rows)
-        {
-            if ((row % 2) && (wiring == LedMatrixWiring::serpentine))
-                return (row * column_count) + INV(column_count, col);
-            else
-                return (row * column_count) + col;
-        }
-        else
-        {
-            if ((col % 2) && (wiring == LedMatrixWiring::serpentine))
-                return (col * row_count) + INV(row_count, row);
-            else
-                return (col * row_count) + row;
-        }
-    }
-    break;
-    case LedMatrixFirstPixel::top_right:
-    {
-        if (arrangement == LedMatrixArrangement::rows)
-        {
-            if ((row % 2) && (wiring == LedMatrixWiring::serpentine))
-                return (row * column_count) + col;
-            else
-                return (row * column_count) + INV(column_count, col);
-        }
-        else
-        {
-            if ((col % 2) && (wiring == LedMatrixWiring::serpentine))
-                return (INV(column_count, col) * row_count) +
-                       INV(row_count, row);
-            else
-                return (INV(column_count, col) * row_count) + row;
-        }
-    }
-    break;
-    case LedMatrixFirstPixel::bottom_left:
-    {
-        if (arrangement == LedMatrixArrangement::rows)
-        {
-            if ((row % 2) && (wiring == LedMatrixWiring::serpentine))
-                return (INV(row_count, row) * column_count) +
-                       INV(column_count, col);
-            else
-                return (INV(row_count, row) * column_count) + col;
-        }
-        else
-        {
-            if ((col % 2) && (wiring == LedMatrixWiring::serpentine))
-                return (col * row_count) + row;
-            else
-                return (col * row_count) + INV(row_count, row);
-        }
-    }
-    break;
-    case LedMatrixFirstPixel::bottom_right:
-    {
-        if (arrangement == LedMatrixArrangement::rows)
-        {
-            if ((row % 2) && (wiring == LedMatrixWiring::serpentine))
-                return (INV(row_count, row) * column_count) + col;
-            else
-                return (INV(row_count, row) * column_count) +
-                       INV(column_count, col);
-        }
-        else
-        {
-            if ((col % 2) && (wiring == LedMatrixWiring::serpentine))
-                return (INV(column_count, col) * row_count) + row;
-            else
-                return (INV(column_count, col) * row_count) +
-                       INV(row_count, row);
-        }
-    }
-    break;
-    } // switch
-    assert(false && "switch statement failure");
-    return (::std::size_t)-1;
+    // Note: 64 bits are required to avoid overflow in large LED strips
+    ::std::uint64_t weighted =
+        ((::std::uint64_t)red_sum * red_milliamps) +
+        ((::std::uint64_t)green_sum * green_milliamps) +
+        ((::std::uint64_t)blue_sum * blue_milliamps);
+    weighted = (weighted * factor) / (255 * 256);
+    return weighted + (pixel_count * idle_milliamps);
 }
 
-::std::size_t LedMatrixParameters::canonicalIndex(
-    ::std::size_t index) const noexcept
+::std::uint16_t PowerBudget::scale(
+    ::std::uint32_t milliamps,
+    ::std::size_t pixel_count) const noexcept
 {
-    ::std::size_t row, col;
-    indexToCoordinates(index, row, col);
-    return (row * column_count) + col;
+    if ((max_milliamps == 0) || (milliamps <= max_milliamps))
+        return 256;
+    ::std::uint32_t idle = pixel_count * idle_milliamps;
+    if (max_milliamps <= idle)
+        return 0;
+    // Note: milliamps > max_milliamps > idle, so there is no division by zero
+    return ((::std::uint64_t)(max_milliamps - idle) * 256) / (milliamps - idle);
 }
-
-void LedMatrixParameters::flipVertical() noexcept
-{
-    switch (first_pixel)
-    {
-    case LedMatrixFirstPixel::top_left:
-        first_pixel = LedMatrixFirstPixel::bottom_left;
-        break;
-    case LedMatrixFirstPixel::top_right:
-        first_pixel = LedMatrixFirstPixel::bottom_right;
-        break;
-    case LedMatrixFirstPixel::bottom_left:
-        first_pixel = LedMatrixFirstPixel::top_left;
-        break;
-    case LedMatrixFirstPixel::bottom_right:
-        first_pixel = LedMatrixFirstPixel::top_right;
-        break;
-    } // switch
-}
-
-void LedMatrixParameters::flipHorizontal() noexcept
-{
-    switch (first_pixel)
-    {
-    case LedMatrixFirstPixel::top_left:
-        first_pixel = LedMatrixFirstPixel::top_right;
-        break;
-    case LedMatrixFirstPixel::top_right:
-        first_pixel = LedMatrixFirstPixel::top_left;
-        break;
-    case LedMatrixFirstPixel::bottom_left:
-        first_pixel = LedMatrixFirstPixel::bottom_right;
-        break;
-    case LedMatrixFirstPixel::bottom_right:
-        first_pixel = LedMatrixFirstPixel::bottom_left;
-        break;
-    } // switch
-}
-
-void LedMatrixParameters::rotate90clockwise() noexcept
-{
-    auto tmp = row_count;
-    row_count = column_count;
-    column_count = tmp;
-    if (arrangement == LedMatrixArrangement::rows)
-        arrangement = LedMatrixArrangement::columns;
-    else
-        arrangement = LedMatrixArrangement::rows;
-    switch (first_pixel)
-    {
-    case LedMatrixFirstPixel::top_left:
-        first_pixel = LedMatrixFirstPixel::top_right;
-        break;
-    case LedMatrixFirstPixel::top_right:
-        first_pixel = LedMatrixFirstPixel::bottom_right;
-        break;
-    case LedMatrixFirstPixel::bottom_left:
-        first_pixel = LedMatrixFirstPixel::top_left;
-        break;
-    case LedMatrixFirstPixel::bottom_right:
-        first_pixel = LedMatrixFirstPixel::bottom_left;
-        break;
-    } // switch
-}
\ No newline at end of file
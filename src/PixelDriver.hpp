@@ -13,6 +13,10 @@
 #pragma once
 
 #include <cstdint>
+#include <cstddef>
+#include <cassert>
+#include <array>
+#include <limits>
 #include <chrono>
 
 //------------------------------------------------------------------------------
@@ -181,6 +185,30 @@ struct LedMatrixParameters
     /// @brief Wiring schema
     LedMatrixWiring wiring = LedMatrixWiring::serpentine;
 
+    /**
+     * @brief Check if the first pixel is located at the bottom
+     *
+     * @return true If the first pixel is in the bottom row
+     * @return false If the first pixel is in the top row
+     */
+    constexpr bool startsAtBottom() const noexcept
+    {
+        return (first_pixel == LedMatrixFirstPixel::bottom_left) ||
+               (first_pixel == LedMatrixFirstPixel::bottom_right);
+    }
+
+    /**
+     * @brief Check if the first pixel is located at the right
+     *
+     * @return true If the first pixel is in the rightmost column
+     * @return false If the first pixel is in the leftmost column
+     */
+    constexpr bool startsAtRight() const noexcept
+    {
+        return (first_pixel == LedMatrixFirstPixel::top_right) ||
+               (first_pixel == LedMatrixFirstPixel::bottom_right);
+    }
+
     /**
      * @brief Retrieve the coordinates of a pixel index according to
      *        this working parameters
@@ -191,24 +219,58 @@ struct LedMatrixParameters
      * @param[out] row Pixel row
      * @param[out] col Pixel column
      */
-    void indexToCoordinates(
+    constexpr void indexToCoordinates(
         ::std::size_t index,
         ::std::size_t &row,
-        ::std::size_t &col) const noexcept;
+        ::std::size_t &col) const noexcept
+    {
+        assert(index < size());
+        // Note: "major" is the wired row or column,
+        // "minor" is the position inside it
+        bool by_rows = (arrangement == LedMatrixArrangement::rows);
+        ::std::size_t minor_count = by_rows ? column_count : row_count;
+        ::std::size_t major = index / minor_count;
+        ::std::size_t minor = index % minor_count;
+        if ((wiring == LedMatrixWiring::serpentine) && (major % 2))
+            minor = (minor_count - 1) - minor;
+        row = by_rows ? major : minor;
+        col = by_rows ? minor : major;
+        if (startsAtBottom())
+            row = (row_count - 1) - row;
+        if (startsAtRight())
+            col = (column_count - 1) - col;
+    }
 
     /**
      * @brief Retrieve the index of the given pixel coordinates
      *        according to this working parameters
      *
+     * @note Inverse of indexToCoordinates()
+     *
      * @warning Bounds are checked with assertions, only.
      *
      * @param row Pixel row
      * @param col Pixel column
      * @return ::std::size_t Pixel index
      */
-    ::std::size_t coordinatesToIndex(
+    constexpr ::std::size_t coordinatesToIndex(
         ::std::size_t row,
-        ::std::size_t col) const noexcept;
+        ::std::size_t col) const noexcept
+    {
+        assert(row < row_count);
+        assert(col < column_count);
+        if (startsAtBottom())
+            row = (row_count - 1) - row;
+        if (startsAtRight())
+            col = (column_count - 1) - col;
+        bool by_rows = (arrangement == LedMatrixArrangement::rows);
+        ::std::size_t minor_count = by_rows ? column_count : row_count;
+        ::std::size_t major = by_rows ? row : col;
+        ::std::size_t minor = by_rows ? col : row;
+        if ((wiring == LedMatrixWiring::serpentine) && (major % 2))
+            minor = (minor_count - 1) - minor;
+        return (major * minor_count) + minor;
+    }
 
     /**
      * @brief Retrieve the canonical index of the given pixel index
@@ -219,7 +281,12 @@ struct LedMatrixParameters
      * @param index Pixel index
      * @return ::std::size_t Canonical pixel index
      */
-    ::std::size_t canonicalIndex(::std::size_t index) const noexcept;
+    constexpr ::std::size_t canonicalIndex(::std::size_t index) const noexcept
+    {
+        ::std::size_t row = 0, col = 0;
+        indexToCoordinates(index, row, col);
+        return (row * column_count) + col;
+    }
 
     /**
      * @brief Compare to other working parameters
@@ -228,7 +295,8 @@ struct LedMatrixParameters
      * @return true If equal
      * @return false If not equal
      */
-    bool operator==(const LedMatrixParameters &other) const noexcept
+    constexpr bool operator==(
+        const LedMatrixParameters &other) const noexcept
     {
         return (other.row_count == row_count) &&
                (other.column_count == column_count) &&
@@ -238,17 +306,78 @@ struct LedMatrixParameters
     }
 
     /// @brief Reverse display along the horizontal axis
-    void flipVertical() noexcept;
+    constexpr void flipVertical() noexcept
+    {
+        switch (first_pixel)
+        {
+        case LedMatrixFirstPixel::top_left:
+            first_pixel = LedMatrixFirstPixel::bottom_left;
+            break;
+        case LedMatrixFirstPixel::top_right:
+            first_pixel = LedMatrixFirstPixel::bottom_right;
+            break;
+        case LedMatrixFirstPixel::bottom_left:
+            first_pixel = LedMatrixFirstPixel::top_left;
+            break;
+        case LedMatrixFirstPixel::bottom_right:
+            first_pixel = LedMatrixFirstPixel::top_right;
+            break;
+        } // switch
+    }
 
     /// @brief Reverse display along the vertical axis
-    void flipHorizontal() noexcept;
+    constexpr void flipHorizontal() noexcept
+    {
+        switch (first_pixel)
+        {
+        case LedMatrixFirstPixel::top_left:
+            first_pixel = LedMatrixFirstPixel::top_right;
+            break;
+        case LedMatrixFirstPixel::top_right:
+            first_pixel = LedMatrixFirstPixel::top_left;
+            break;
+        case LedMatrixFirstPixel::bottom_left:
+            first_pixel = LedMatrixFirstPixel::bottom_right;
+            break;
+        case LedMatrixFirstPixel::bottom_right:
+            first_pixel = LedMatrixFirstPixel::bottom_left;
+            break;
+        } // switch
+    }
 
     /// @brief Rotate display 90 degrees clockwise
     /// @note Make several calls to rotate 180 or 270 degrees.
-    void rotate90clockwise() noexcept;
+    constexpr void rotate90clockwise() noexcept
+    {
+        ::std::size_t tmp = row_count;
+        row_count = column_count;
+        column_count = tmp;
+        if (arrangement == LedMatrixArrangement::rows)
+            arrangement = LedMatrixArrangement::columns;
+        else
+            arrangement = LedMatrixArrangement::rows;
+        switch (first_pixel)
+        {
+        case LedMatrixFirstPixel::top_left:
+            first_pixel = LedMatrixFirstPixel::top_right;
+            break;
+        case LedMatrixFirstPixel::top_right:
+            first_pixel = LedMatrixFirstPixel::bottom_right;
+            break;
+        case LedMatrixFirstPixel::bottom_left:
+            first_pixel = LedMatrixFirstPixel::top_left;
+            break;
+        case LedMatrixFirstPixel::bottom_right:
+            first_pixel = LedMatrixFirstPixel::bottom_left;
+            break;
+        } // switch
+    }
 
     /// @brief Size in pixels
-    ::std::size_t size() const noexcept { return (row_count * column_count); }
+    constexpr ::std::size_t size() const noexcept
+    {
+        return (row_count * column_count);
+    }
 };
 
 /// @brief Basic parameters for an LED strip (1D LED Matrix)
@@ -267,4 +396,207 @@ static constexpr const LedMatrixParameters basicReversedLedStriParameters{
     .first_pixel = LedMatrixFirstPixel::bottom_right,
     .arrangement = LedMatrixArrangement::rows,
     .wiring = LedMatrixWiring::linear,
-};
\ No newline at end of file
+};
+
+//------------------------------------------------------------------------------
+
+/**
+ * @brief LED matrix layout fixed at compile time
+ *
+ * @note All parameters are constants, so the compiler reduces
+ *       the index mapping to a few arithmetic operations.
+ *       Any mapping can be computed in a constant expression
+ *       (for example, in static_assert()).
+ *
+ * @note Lookup tables built by canonicalTable() or wireTable()
+ *       and stored in a `static constexpr` variable
+ *       are placed in flash memory, not in RAM. For example:
+ *
+ *       ```c++
+ *       using Panel = LedMatrixLayout<8, 32, LedMatrixFirstPixel::top_left,
+ *           LedMatrixArrangement::columns, LedMatrixWiring::serpentine>;
+ *       static constexpr auto table = Panel::canonicalTable();
+ *       WS2812LEDStrip matrix(Panel::parameters, DATA_PIN, false);
+ *       ```
+ *
+ * @tparam Rows Number of rows
+ * @tparam Columns Number of columns
+ * @tparam FirstPixel First pixel in the pixel chain
+ * @tparam Arrangement Arrangement of rows and columns
+ * @tparam Wiring Wiring schema
+ */
+template <
+    ::std::size_t Rows,
+    ::std::size_t Columns,
+    LedMatrixFirstPixel FirstPixel = LedMatrixFirstPixel::top_left,
+    LedMatrixArrangement Arrangement = LedMatrixArrangement::rows,
+    LedMatrixWiring Wiring = LedMatrixWiring::serpentine>
+struct LedMatrixLayout
+{
+    static_assert((Rows > 0) && (Columns > 0), "Empty LED matrix");
+
+    /// @brief Number of rows
+    static constexpr ::std::size_t row_count = Rows;
+    /// @brief Number of columns
+    static constexpr ::std::size_t column_count = Columns;
+    /// @brief Size in pixels
+    static constexpr ::std::size_t pixel_count = Rows * Columns;
+
+    /// @brief Equivalent working parameters
+    static constexpr LedMatrixParameters parameters{
+        .row_count = Rows,
+        .column_count = Columns,
+        .first_pixel = FirstPixel,
+        .arrangement = Arrangement,
+        .wiring = Wiring,
+    };
+
+    /**
+     * @brief Retrieve the index of the given pixel coordinates
+     *
+     * @param row Pixel row
+     * @param col Pixel column
+     * @return ::std::size_t Pixel index
+     */
+    static constexpr ::std::size_t coordinatesToIndex(
+        ::std::size_t row,
+        ::std::size_t col) noexcept
+    {
+        return parameters.coordinatesToIndex(row, col);
+    }
+
+    /**
+     * @brief Retrieve the canonical index of the given pixel index
+     *
+     * @param index Pixel index
+     * @return ::std::size_t Canonical pixel index
+     */
+    static constexpr ::std::size_t canonicalIndex(::std::size_t index) noexcept
+    {
+        return parameters.canonicalIndex(index);
+    }
+
+    /**
+     * @brief Retrieve the pixel index of the given canonical index
+     *
+     * @note Inverse of canonicalIndex()
+     *
+     * @param canonical Canonical pixel index
+     * @return ::std::size_t Pixel index
+     */
+    static constexpr ::std::size_t wireIndex(::std::size_t canonical) noexcept
+    {
+        return parameters.coordinatesToIndex(
+            canonical / Columns,
+            canonical % Columns);
+    }
+
+    /**
+     * @brief Build a table of canonical indices
+     *
+     * @tparam Index Type of the table entries
+     * @return ::std::array<Index, pixel_count> Canonical index of
+     *         each pixel index
+     */
+    template <typename Index = ::std::uint16_t>
+    static constexpr ::std::array<Index, pixel_count> canonicalTable() noexcept
+    {
+        static_assert(
+            pixel_count - 1 <= ::std::numeric_limits<Index>::max(),
+            "Index type too small");
+        ::std::array<Index, pixel_count> table{};
+        for (::std::size_t i = 0; i < pixel_count; i++)
+            table[i] = static_cast<Index>(canonicalIndex(i));
+        return table;
+    }
+
+    /**
+     * @brief Build a table of pixel indices
+     *
+     * @tparam Index Type of the table entries
+     * @return ::std::array<Index, pixel_count> Pixel index of
+     *         each canonical index
+     */
+    template <typename Index = ::std::uint16_t>
+    static constexpr ::std::array<Index, pixel_count> wireTable() noexcept
+    {
+        static_assert(
+            pixel_count - 1 <= ::std::numeric_limits<Index>::max(),
+            "Index type too small");
+        ::std::array<Index, pixel_count> table{};
+        for (::std::size_t i = 0; i < pixel_count; i++)
+            table[i] = static_cast<Index>(wireIndex(i));
+        return table;
+    }
+};
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Power budget of an LED strip
+ *
+ * @note Current draw is estimated from channel values:
+ *       a channel at full intensity (255) draws the configured
+ *       current, a channel at half intensity draws half that current,
+ *       and so on.
+ */
+struct PowerBudget
+{
+    /// @brief Maximum current draw in milliamperes (0 means no limit)
+    ::std::uint32_t max_milliamps = 0;
+    /// @brief Supply voltage in volts (typically 5 or 12)
+    ::std::uint8_t volts = 5;
+    /// @brief Current draw of a red channel at full intensity (milliamperes)
+    ::std::uint8_t red_milliamps = 20;
+    /// @brief Current draw of a green channel at full intensity (milliamperes)
+    ::std::uint8_t green_milliamps = 20;
+    /// @brief Current draw of a blue channel at full intensity (milliamperes)
+    ::std::uint8_t blue_milliamps = 20;
+    /// @brief Current draw of a pixel when all channels are off (milliamperes)
+    ::std::uint8_t idle_milliamps = 1;
+
+    /**
+     * @brief Estimate the current draw of a frame
+     *
+     * @param red_sum Sum of all red channel values in the frame
+     * @param green_sum Sum of all green channel values in the frame
+     * @param blue_sum Sum of all blue channel values in the frame
+     * @param pixel_count Number of pixels in the frame
+     * @param factor Scale factor applied to all channel values,
+     *               in the range [0,256]. 256 means no scaling.
+     * @return ::std::uint32_t Estimated current draw in milliamperes
+     */
+    ::std::uint32_t milliamps(
+        ::std::uint32_t red_sum,
+        ::std::uint32_t green_sum,
+        ::std::uint32_t blue_sum,
+        ::std::size_t pixel_count,
+        ::std::uint16_t factor = 256) const noexcept;
+
+    /**
+     * @brief Compute the scale factor required to meet this budget
+     *
+     * @param milliamps Estimated current draw without power limitation
+     * @param pixel_count Number of pixels in the frame
+     * @return ::std::uint16_t Scale factor in the range [0,256].
+     *                         256 means the frame is within budget.
+     */
+    ::std::uint16_t scale(
+        ::std::uint32_t milliamps,
+        ::std::size_t pixel_count) const noexcept;
+};
+
+/**
+ * @brief Power statistics of the last displayed frame
+ *
+ */
+struct PowerStatistics
+{
+    /// @brief Estimated current draw before power limitation (milliamperes)
+    ::std::uint32_t requested_milliamps = 0;
+    /// @brief Estimated current draw after power limitation (milliamperes)
+    ::std::uint32_t milliamps = 0;
+    /// @brief Estimated power draw after power limitation (milliwatts)
+    ::std::uint32_t milliwatts = 0;
+    /// @brief Applied scale factor. 255 means no reduction.
+    ::std::uint8_t scale = 255;
+};
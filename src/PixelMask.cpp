@@ -0,0 +1,383 @@
+/**
+ * @file PixelMask.cpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief One-bit masks of pixels
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 License
+ */
+
+#include "PixelMask.hpp"
+#include <algorithm> // For ::std::rotate() and ::std::min()
+#include <cstring>   // For ::std::memmove()
+
+//------------------------------------------------------------------------------
+// Auxiliary
+//------------------------------------------------------------------------------
+
+using word_type = PixelMask::word_type;
+using size_type = PixelMask::size_type;
+
+static constexpr word_type all_bits = ~word_type(0);
+static constexpr size_type word_bits = PixelMask::word_bits;
+
+/**
+ * @brief Set a range of bits in a multi-word bit vector
+ *
+ * @param words Bit vector
+ * @param from First bit (inclusive)
+ * @param to Last bit (exclusive)
+ * @param value True to set, false to clear
+ */
+static void fill_bits(
+    word_type *words,
+    size_type from,
+    size_type to,
+    bool value) noexcept
+{
+    while (from < to)
+    {
+        size_type offset = from % word_bits;
+        size_type count = ::std::min(word_bits - offset, to - from);
+        word_type bits =
+            (count == word_bits)
+                ? all_bits
+                : (((word_type(1) << count) - 1) << offset);
+        if (value)
+            words[from / word_bits] |= bits;
+        else
+            words[from / word_bits] &= ~bits;
+        from += count;
+    }
+}
+
+/**
+ * @brief Shift a multi-word bit vector
+ *
+ * @note Outgoing bits are lost. Incoming bits are clear.
+ *
+ * @param in Source bit vector
+ * @param out Destination bit vector. Bits are OR'ed into it.
+ * @param word_count Count of words in both bit vectors
+ * @param shift Shift count in bits
+ * @param to_lower True to move bits to lower indices
+ */
+static void or_shifted(
+    const word_type *in,
+    word_type *out,
+    size_type word_count,
+    size_type shift,
+    bool to_lower) noexcept
+{
+    size_type word_shift = shift / word_bits;
+    size_type bit_shift = shift % word_bits;
+    for (size_type i = 0; i < word_count; i++)
+    {
+        word_type value = 0;
+        if (to_lower)
+        {
+            size_type j = i + word_shift;
+            if (j < word_count)
+                value = in[j] >> bit_shift;
+            if (bit_shift && (j + 1 < word_count))
+                value |= in[j + 1] << (word_bits - bit_shift);
+        }
+        else if (i >= word_shift)
+        {
+            size_type j = i - word_shift;
+            value = in[j] << bit_shift;
+            if (bit_shift && (j > 0))
+                value |= in[j - 1] >> (word_bits - bit_shift);
+        }
+        out[i] |= value;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+PixelMask::PixelMask(size_type rows, size_type columns, bool value)
+    : rows{rows},
+      columns{columns},
+      words_per_row{(columns + word_bits - 1) / word_bits},
+      words(rows * words_per_row)
+{
+    fill(value);
+}
+
+PixelMask::PixelMask(const PixelMatrix &image)
+    : PixelMask(image.row_count(), image.column_count())
+{
+    for (size_type r = 0; r < rows; r++)
+        for (size_type c = 0; c < columns; c++)
+            if (image(r, c) != Pixel())
+                set(r, c);
+}
+
+//------------------------------------------------------------------------------
+// Bit operations
+//------------------------------------------------------------------------------
+
+PixelMask::word_type PixelMask::lastWordMask() const noexcept
+{
+    size_type bits = columns % word_bits;
+    return (bits) ? ((word_type(1) << bits) - 1) : all_bits;
+}
+
+void PixelMask::trim() noexcept
+{
+    if (words_per_row == 0)
+        return;
+    word_type valid = lastWordMask();
+    for (size_type r = 0; r < rows; r++)
+        words[(r * words_per_row) + words_per_row - 1] &= valid;
+}
+
+void PixelMask::fill(bool value) noexcept
+{
+    ::std::fill(words.begin(), words.end(), (value) ? all_bits : 0);
+    if (value)
+        trim();
+}
+
+void PixelMask::fill(const PixelRect &area, bool value) noexcept
+{
+    if ((area.row >= rows) || (area.column >= columns))
+        return;
+    size_type last_row = ::std::min(area.row + area.row_count, rows);
+    size_type last_column =
+        ::std::min(area.column + area.column_count, columns);
+    for (size_type r = area.row; r < last_row; r++)
+        fill_bits(
+            words.data() + (r * words_per_row),
+            area.column,
+            last_column,
+            value);
+}
+
+void PixelMask::invert() noexcept
+{
+    for (word_type &word : words)
+        word = ~word;
+    trim();
+}
+
+PixelMask::size_type PixelMask::count() const noexcept
+{
+    size_type result = 0;
+    for (word_type word : words)
+        result += __builtin_popcount(word);
+    return result;
+}
+
+//------------------------------------------------------------------------------
+// Scrolling
+//------------------------------------------------------------------------------
+
+void PixelMask::scrollRow(
+    word_type *row,
+    word_type *scratch,
+    size_type count,
+    bool left,
+    bool wrap,
+    bool value) noexcept
+{
+    if (words_per_row <= 2)
+    {
+        // Note: rows up to 64 columns are shifted as a single integer
+        uint64_t bits = row[0];
+        if (words_per_row == 2)
+            bits |= uint64_t(row[1]) << word_bits;
+        uint64_t valid =
+            (columns == 64) ? ~uint64_t(0) : ((uint64_t(1) << columns) - 1);
+        uint64_t incoming = (value) ? valid : 0;
+        if (left)
+        {
+            incoming &= ~(valid >> count);
+            bits = (bits >> count) |
+                   ((wrap) ? (bits << (columns - count)) : incoming);
+        }
+        else
+        {
+            incoming &= ~(valid << count);
+            bits = (bits << count) |
+                   ((wrap) ? (bits >> (columns - count)) : incoming);
+        }
+        bits &= valid;
+        row[0] = static_cast<word_type>(bits);
+        if (words_per_row == 2)
+            row[1] = static_cast<word_type>(bits >> word_bits);
+        return;
+    }
+    ::std::copy(row, row + words_per_row, scratch);
+    ::std::fill(row, row + words_per_row, 0);
+    // Note: scrolling left moves bits to lower column indices
+    or_shifted(scratch, row, words_per_row, count, left);
+    if (wrap)
+        or_shifted(scratch, row, words_per_row, columns - count, !left);
+    else if (left)
+        fill_bits(row, columns - count, columns, value);
+    else
+        fill_bits(row, 0, count, value);
+    row[words_per_row - 1] &= lastWordMask();
+}
+
+void PixelMask::scroll(ScrollDirection direction, size_type count) noexcept
+{
+    if ((direction == ScrollDirection::up) ||
+        (direction == ScrollDirection::down))
+    {
+        if (rows == 0)
+            return;
+        count %= rows;
+        if (direction == ScrollDirection::down)
+            count = (rows - count) % rows;
+        ::std::rotate(
+            words.begin(),
+            words.begin() + (count * words_per_row),
+            words.end());
+    }
+    else
+    {
+        if (columns == 0)
+            return;
+        count %= columns;
+        if (count == 0)
+            return;
+        ::std::vector<word_type> scratch(words_per_row);
+        for (size_type r = 0; r < rows; r++)
+            scrollRow(
+                words.data() + (r * words_per_row),
+                scratch.data(),
+                count,
+                direction == ScrollDirection::left,
+                true,
+                false);
+    }
+}
+
+void PixelMask::scroll(
+    ScrollDirection direction,
+    size_type count,
+    bool value) noexcept
+{
+    if (count == 0)
+        return;
+    bool vertical = (direction == ScrollDirection::up) ||
+                    (direction == ScrollDirection::down);
+    if (count >= ((vertical) ? rows : columns))
+    {
+        fill(value);
+        return;
+    }
+    if (vertical)
+    {
+        size_type moved = (rows - count) * words_per_row;
+        size_type incoming = count * words_per_row;
+        if (direction == ScrollDirection::up)
+        {
+            ::std::memmove(
+                words.data(),
+                words.data() + incoming,
+                moved * sizeof(word_type));
+            fill(PixelRect{rows - count, 0, count, columns}, value);
+        }
+        else
+        {
+            ::std::memmove(
+                words.data() + incoming,
+                words.data(),
+                moved * sizeof(word_type));
+            fill(PixelRect{0, 0, count, columns}, value);
+        }
+    }
+    else
+    {
+        ::std::vector<word_type> scratch(words_per_row);
+        for (size_type r = 0; r < rows; r++)
+            scrollRow(
+                words.data() + (r * words_per_row),
+                scratch.data(),
+                count,
+                direction == ScrollDirection::left,
+                false,
+                value);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Composition
+//------------------------------------------------------------------------------
+
+template <typename Op>
+void PixelMask::compose(
+    PixelVector &pixels,
+    bool set_bits,
+    Op op) const noexcept
+{
+    size_type limit = ::std::min(pixels.size(), size());
+    if (limit == 0)
+        return;
+    Pixel *data = pixels.data();
+    word_type valid = lastWordMask();
+    for (size_type r = 0; r < rows; r++)
+    {
+        size_type base = r * columns;
+        if (base >= limit)
+            break;
+        const word_type *row = rowWords(r);
+        for (size_type w = 0; w < words_per_row; w++)
+        {
+            word_type word = (set_bits) ? row[w] : ~row[w];
+            if (w == words_per_row - 1)
+                word &= valid;
+            // Note: 32 pixels at once
+            if (word == 0)
+                continue;
+            size_type first = base + (w * word_bits);
+            while (word)
+            {
+                size_type index = first + __builtin_ctz(word);
+                if (index >= limit)
+                    break;
+                op(data[index]);
+                word &= word - 1;
+            }
+        }
+    }
+    pixels.markDirty(0, limit - 1);
+}
+
+void PixelMask::tint(PixelVector &pixels, const Pixel &color) const noexcept
+{
+    compose(
+        pixels,
+        true,
+        [&color](Pixel &pixel)
+        { pixel = color; });
+}
+
+void PixelMask::mask(PixelVector &pixels) const noexcept
+{
+    compose(
+        pixels,
+        false,
+        [](Pixel &pixel)
+        { pixel = Pixel(); });
+}
+
+void PixelMask::invert(PixelVector &pixels) const noexcept
+{
+    compose(
+        pixels,
+        true,
+        [](Pixel &pixel)
+        {
+            pixel.red = ~pixel.red;
+            pixel.green = ~pixel.green;
+            pixel.blue = ~pixel.blue;
+        });
+}
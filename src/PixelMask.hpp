@@ -0,0 +1,293 @@
+/**
+ * @file PixelMask.hpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief One-bit masks of pixels
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 License
+ */
+
+#pragma once
+
+//------------------------------------------------------------------------------
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cassert>
+#include "PixelVector.hpp"
+
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Bit-packed one-bit image
+ *
+ * @note Bits are stored in row-major order, 32 bits per word.
+ *       Each row starts at a new word.
+ *       Most operations process a whole word at once.
+ *       Bit masks may be composed onto a PixelVector or PixelMatrix
+ *       of the same size (in row-major order).
+ */
+class PixelMask
+{
+public:
+    /// @brief Unsigned integer type
+    using size_type = PixelVector::size_type;
+    /// @brief Storage word type
+    using word_type = uint32_t;
+    /// @brief Count of bits per storage word
+    static constexpr size_type word_bits = 32;
+
+    /**
+     * @brief Create an empty mask
+     *
+     */
+    PixelMask() noexcept {}
+
+    /**
+     * @brief Create a mask
+     *
+     * @param rows Row count
+     * @param columns Column count
+     * @param value Initial value of all bits
+     */
+    PixelMask(size_type rows, size_type columns, bool value = false);
+
+    /**
+     * @brief Create a mask from the lit pixels of a matrix
+     *
+     * @param image Source image. Non-black pixels are set.
+     */
+    explicit PixelMask(const PixelMatrix &image);
+
+    /**
+     * @brief Get the count of rows
+     *
+     * @return size_type Row count
+     */
+    size_type row_count() const noexcept { return rows; }
+
+    /**
+     * @brief Get the count of columns
+     *
+     * @return size_type Column count
+     */
+    size_type column_count() const noexcept { return columns; }
+
+    /**
+     * @brief Get the count of bits
+     *
+     * @return size_type Rows times columns
+     */
+    size_type size() const noexcept { return rows * columns; }
+
+    /**
+     * @brief Get a bit
+     *
+     * @note No bounds checking, except for assertions
+     *
+     * @param row Row index
+     * @param column Column index
+     * @return true If set
+     * @return false If clear
+     */
+    bool operator()(size_type row, size_type column) const noexcept
+    {
+        assert((row < rows) && (column < columns));
+        return (words[wordIndex(row, column)] >> (column % word_bits)) & 1;
+    }
+
+    /**
+     * @brief Set or clear a bit
+     *
+     * @note No bounds checking, except for assertions
+     *
+     * @param row Row index
+     * @param column Column index
+     * @param value True to set, false to clear
+     */
+    void set(size_type row, size_type column, bool value = true) noexcept
+    {
+        assert((row < rows) && (column < columns));
+        word_type bit = word_type(1) << (column % word_bits);
+        if (value)
+            words[wordIndex(row, column)] |= bit;
+        else
+            words[wordIndex(row, column)] &= ~bit;
+    }
+
+    /**
+     * @brief Clear a bit
+     *
+     * @param row Row index
+     * @param column Column index
+     */
+    void clear(size_type row, size_type column) noexcept
+    {
+        set(row, column, false);
+    }
+
+    /**
+     * @brief Set or clear all bits
+     *
+     * @param value True to set, false to clear
+     */
+    void fill(bool value) noexcept;
+
+    /**
+     * @brief Set or clear all bits in a rectangular area
+     *
+     * @param area Area. Clipped to the bounds of this mask.
+     * @param value True to set, false to clear
+     */
+    void fill(const PixelRect &area, bool value) noexcept;
+
+    /**
+     * @brief Invert all bits
+     *
+     */
+    void invert() noexcept;
+
+    /**
+     * @brief Count the set bits
+     *
+     * @return size_type Count of set bits
+     */
+    size_type count() const noexcept;
+
+    /**
+     * @brief Scroll all bits (wrap around)
+     *
+     * @note Same semantics as PixelMatrix::scroll()
+     *
+     * @param direction Scroll direction
+     * @param count Count of rows or columns
+     */
+    void scroll(ScrollDirection direction, size_type count = 1) noexcept;
+
+    /**
+     * @brief Scroll all bits (fill)
+     *
+     * @note Same semantics as PixelMatrix::scroll()
+     *
+     * @param direction Scroll direction
+     * @param count Count of rows or columns
+     * @param value Value of the incoming bits
+     */
+    void scroll(
+        ScrollDirection direction,
+        size_type count,
+        bool value) noexcept;
+
+    /**
+     * @brief Set pixels to a color where bits are set
+     *
+     * @param pixels Pixels in row-major order
+     * @param color Color
+     */
+    void tint(PixelVector &pixels, const Pixel &color) const noexcept;
+
+    /**
+     * @brief Set pixels to black where bits are clear
+     *
+     * @param pixels Pixels in row-major order
+     */
+    void mask(PixelVector &pixels) const noexcept;
+
+    /**
+     * @brief Invert pixel colors where bits are set
+     *
+     * @param pixels Pixels in row-major order
+     */
+    void invert(PixelVector &pixels) const noexcept;
+
+    /**
+     * @brief Get the storage words of a row
+     *
+     * @note Bit N of word W is column (W*32)+N.
+     *       Unused bits in the last word are always clear.
+     *
+     * @param row Row index
+     * @return const word_type* First word of @p row
+     */
+    const word_type *rowWords(size_type row) const noexcept
+    {
+        assert(row < rows);
+        return words.data() + (row * words_per_row);
+    }
+
+    /**
+     * @brief Get the count of storage words per row
+     *
+     * @return size_type Word count
+     */
+    size_type wordsPerRow() const noexcept { return words_per_row; }
+
+private:
+    /// @brief Row count
+    size_type rows = 0;
+    /// @brief Column count
+    size_type columns = 0;
+    /// @brief Storage words per row
+    size_type words_per_row = 0;
+    /// @brief Storage
+    ::std::vector<word_type> words{};
+
+    /**
+     * @brief Get the index of the word holding a bit
+     *
+     * @param row Row index
+     * @param column Column index
+     * @return size_type Word index
+     */
+    size_type wordIndex(size_type row, size_type column) const noexcept
+    {
+        return (row * words_per_row) + (column / word_bits);
+    }
+
+    /**
+     * @brief Get the valid bits of the last word in a row
+     *
+     * @return word_type Bit mask
+     */
+    word_type lastWordMask() const noexcept;
+
+    /**
+     * @brief Clear the unused bits of the last word in every row
+     *
+     */
+    void trim() noexcept;
+
+    /**
+     * @brief Scroll a row to the left or to the right
+     *
+     * @param row First word of the row
+     * @param scratch Buffer for one row
+     * @param count Count of columns. Must be less than the column count.
+     * @param left True to scroll left, false to scroll right
+     * @param wrap True to wrap around, false to fill
+     * @param value Value of the incoming bits if not wrapping around
+     */
+    void scrollRow(
+        word_type *row,
+        word_type *scratch,
+        size_type count,
+        bool left,
+        bool wrap,
+        bool value) noexcept;
+
+    /**
+     * @brief Apply an operation to the pixels at set or clear bits
+     *
+     * @note Words having no selected bits are skipped at once
+     *
+     * @tparam Op Operation type
+     * @param pixels Pixels in row-major order
+     * @param set_bits True to select set bits, false to select clear bits
+     * @param op Operation to apply to each selected pixel
+     */
+    template <typename Op>
+    void compose(PixelVector &pixels, bool set_bits, Op op) const noexcept;
+};
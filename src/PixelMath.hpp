@@ -0,0 +1,655 @@
+/**
+ * @file PixelMath.hpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Fixed-point helpers for pixel kernels (internal use)
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 License
+ */
+
+#pragma once
+
+//------------------------------------------------------------------------------
+
+#include "Pixel.hpp"
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Fixed-point helpers shared by pixel kernels
+ *
+ * @note Not part of the public API
+ */
+namespace PixelMath
+{
+    //--------------------------------------------------------------------------
+    // HSL -> RGB
+    //--------------------------------------------------------------------------
+
+    /**
+     * @brief Hue-independent terms of the HSL to RGB conversion
+     *
+     */
+    struct HslTerms
+    {
+        /// @brief Chroma in the range [0,255]
+        int chroma;
+        /// @brief Value added to all channels in the range [0,255]
+        int match;
+    };
+
+    /**
+     * @brief Compute the hue-independent terms of the HSL to RGB conversion
+     *
+     * @param saturation Saturation in the range [0,255]
+     * @param luminance Luminance in the range [0,255]
+     * @return HslTerms Chroma and match values
+     */
+    inline HslTerms hslTerms(uint8_t saturation, uint8_t luminance) noexcept
+    {
+        HslTerms result;
+        result.chroma =
+            ((255 - ::std::abs((2 * luminance) - 255)) * saturation) / 254;
+        result.match = luminance - (result.chroma / 2);
+        // Note: chroma + match may overflow for luminance=128
+        if ((result.chroma + result.match) > 255)
+            result.chroma = 255 - result.match;
+        return result;
+    }
+
+    /**
+     * @brief Assign RGB channels given a hue sector
+     *
+     * @param pixel Pixel to be assigned
+     * @param sector Hue sector (60 degrees each) in the range [0,5]
+     * @param x Secondary component in the range [0,chroma]
+     * @param terms Hue-independent terms
+     */
+    inline void hslAssign(
+        Pixel &pixel,
+        unsigned int sector,
+        int x,
+        const HslTerms &terms) noexcept
+    {
+        int c = terms.chroma + terms.match;
+        int m = terms.match;
+        x += m;
+        switch (sector)
+        {
+        case 0:
+            pixel.red = c;
+            pixel.green = x;
+            pixel.blue = m;
+            break;
+        case 1:
+            pixel.red = x;
+            pixel.green = c;
+            pixel.blue = m;
+            break;
+        case 2:
+            pixel.red = m;
+            pixel.green = c;
+            pixel.blue = x;
+            break;
+        case 3:
+            pixel.red = m;
+            pixel.green = x;
+            pixel.blue = c;
+            break;
+        case 4:
+            pixel.red = x;
+            pixel.green = m;
+            pixel.blue = c;
+            break;
+        default:
+            pixel.red = c;
+            pixel.green = m;
+            pixel.blue = x;
+            break;
+        }
+    }
+
+    /**
+     * @brief Assign RGB channels given a 16-bit hue
+     *
+     * @param pixel Pixel to be assigned
+     * @param hue Hue where 65536 units are 360 degrees
+     * @param terms Hue-independent terms
+     */
+    inline void hsl16(
+        Pixel &pixel,
+        uint16_t hue,
+        const HslTerms &terms) noexcept
+    {
+        uint32_t hue6 = hue * 6;
+        unsigned int sector = hue6 >> 16;
+        uint32_t fraction = hue6 & 0xFFFF;
+        if (sector & 1)
+            fraction = 0x10000 - fraction;
+        hslAssign(pixel, sector, (terms.chroma * fraction) >> 16, terms);
+    }
+
+    //--------------------------------------------------------------------------
+    // SWAR (SIMD within a register)
+    //--------------------------------------------------------------------------
+
+    /// @brief Machine word used by SWAR kernels (32 or 64 bits)
+    using Word = ::std::uintptr_t;
+
+    /**
+     * @brief Word having all its bytes set to the same value
+     *
+     * @param byte Byte value
+     * @return constexpr Word Repeated byte
+     */
+    constexpr Word lanes(uint8_t byte) noexcept
+    {
+        return (static_cast<Word>(~static_cast<Word>(0)) / 0xFF) * byte;
+    }
+
+    /// @brief Mask of even bytes in a word (0x00FF00FF...)
+    static constexpr Word even_bytes =
+        (static_cast<Word>(~static_cast<Word>(0)) / 0xFFFF) * 0xFF;
+    /// @brief Mask of the most significant bit in each byte
+    static constexpr Word high_bits = lanes(0x80);
+    /// @brief Mask of the least significant bits in each byte
+    static constexpr Word low_bits = lanes(0x7F);
+
+    /**
+     * @brief Load a word from memory
+     *
+     * @param ptr Pointer to memory
+     * @return Word Loaded word
+     */
+    inline Word load(const uint8_t *ptr) noexcept
+    {
+        Word w;
+        ::std::memcpy(&w, ptr, sizeof(Word));
+        return w;
+    }
+
+    /**
+     * @brief Store a word into memory
+     *
+     * @param ptr Pointer to memory
+     * @param w Word to be stored
+     */
+    inline void store(uint8_t *ptr, Word w) noexcept
+    {
+        ::std::memcpy(ptr, &w, sizeof(Word));
+    }
+
+    /**
+     * @brief Scale all bytes in a word
+     *
+     * @note Each byte becomes (byte * factor) >> 8
+     *
+     * @param w Word
+     * @param factor Scale factor in the range [0,256]
+     * @return Word Scaled word
+     */
+    inline Word scale(Word w, uint16_t factor) noexcept
+    {
+        Word even = (((w & even_bytes) * factor) >> 8) & even_bytes;
+        Word odd = (((w >> 8) & even_bytes) * factor) & ~even_bytes;
+        return even | odd;
+    }
+
+    /**
+     * @brief Saturating addition of all bytes in two words
+     *
+     * @param a First word
+     * @param b Second word
+     * @return Word Byte-wise min(a+b,255)
+     */
+    inline Word addSaturated(Word a, Word b) noexcept
+    {
+        Word sum = (a & low_bits) + (b & low_bits);
+        sum ^= (a ^ b) & high_bits;
+        Word carry = ((a & b) | ((a | b) & ~sum)) & high_bits;
+        return sum | ((carry >> 7) * 0xFF);
+    }
+
+    /**
+     * @brief Saturating subtraction of all bytes in two words
+     *
+     * @param a First word
+     * @param b Second word
+     * @return Word Byte-wise max(a-b,0)
+     */
+    inline Word subSaturated(Word a, Word b) noexcept
+    {
+        Word diff =
+            ((a | high_bits) - (b & low_bits)) ^ ((a ^ ~b) & high_bits);
+        Word borrow = ((~a & b) | (~(a ^ b) & diff)) & high_bits;
+        return diff & ~((borrow >> 7) * 0xFF);
+    }
+
+    /**
+     * @brief Maximum of all bytes in two words
+     *
+     * @param a First word
+     * @param b Second word
+     * @return Word Byte-wise max(a,b)
+     */
+    inline Word maximum(Word a, Word b) noexcept
+    {
+        return b + subSaturated(a, b);
+    }
+
+    /**
+     * @brief Linear interpolation of all bytes in two words
+     *
+     * @note Each byte becomes (a * (256 - weight) + b * weight) >> 8.
+     *       Bytes are computed in 16-bit lanes, which never overflow.
+     *
+     * @param a First word
+     * @param b Second word
+     * @param weight Weight of @p b in the range [0,256]
+     * @return Word Interpolated word
+     */
+    inline Word blend(Word a, Word b, uint16_t weight) noexcept
+    {
+        uint16_t complement = 256 - weight;
+        Word even =
+            ((((a & even_bytes) * complement) +
+              ((b & even_bytes) * weight)) >>
+             8) &
+            even_bytes;
+        Word odd =
+            ((((a >> 8) & even_bytes) * complement) +
+             (((b >> 8) & even_bytes) * weight)) &
+            ~even_bytes;
+        return even | odd;
+    }
+
+    /**
+     * @brief Set the least significant bit of all non-zero bytes in a word
+     *
+     * @param w Word
+     * @return Word Byte-wise (w != 0) ? 1 : 0
+     */
+    inline Word nonZero(Word w) noexcept
+    {
+        return ((((w & low_bits) + low_bits) | w) >> 7) & lanes(1);
+    }
+
+    /**
+     * @brief Move all bytes in a word towards those of another word
+     *
+     * @note Same as blend(), but bytes that differ always move
+     *       at least one unit, provided that @p weight is not zero
+     *
+     * @param a Word to move
+     * @param b Target word
+     * @param weight Weight of @p b in the range [0,256]
+     * @return Word Moved word
+     */
+    inline Word towards(Word a, Word b, uint16_t weight) noexcept
+    {
+        if (weight == 0)
+            return a;
+        Word up = subSaturated(b, a);
+        Word down = subSaturated(a, b);
+        up = maximum(scale(up, weight), nonZero(up));
+        down = maximum(scale(down, weight), nonZero(down));
+        // Note: no carry nor borrow crosses byte boundaries
+        return (a - down) + up;
+    }
+
+    /**
+     * @brief Blend weight given an 8-bit amount
+     *
+     * @note Maps 0 to 0 and 255 to 256, so both ends are exact
+     *       without a division
+     *
+     * @param amount Amount in the range [0,255]
+     * @return uint16_t Weight in the range [0,256]
+     */
+    constexpr uint16_t blendWeight(uint8_t amount) noexcept
+    {
+        return amount + (amount >> 7);
+    }
+
+    /**
+     * @brief Apply a byte-wise operation to a buffer in place
+     *
+     * @note Bytes are processed one word at a time.
+     *       Leading and trailing bytes that do not fill a word
+     *       are processed one at a time.
+     *
+     * @tparam WordOp Callable type: Word(Word)
+     * @tparam ByteOp Callable type: uint8_t(uint8_t)
+     * @param dst Buffer
+     * @param size Buffer size in bytes
+     * @param word_op Operation on words
+     * @param byte_op Equivalent operation on single bytes
+     */
+    template <typename WordOp, typename ByteOp>
+    void apply(
+        uint8_t *dst,
+        ::std::size_t size,
+        WordOp word_op,
+        ByteOp byte_op) noexcept
+    {
+        // Unaligned head
+        while (size &&
+               (reinterpret_cast<::std::uintptr_t>(dst) % sizeof(Word)))
+        {
+            *dst = byte_op(*dst);
+            dst++;
+            size--;
+        }
+        // Aligned body
+        uint8_t *aligned = static_cast<uint8_t *>(
+            __builtin_assume_aligned(dst, sizeof(Word)));
+        ::std::size_t word_count = size / sizeof(Word);
+        for (::std::size_t i = 0; i < word_count; i++)
+        {
+            uint8_t *ptr = aligned + (i * sizeof(Word));
+            store(ptr, word_op(load(ptr)));
+        }
+        dst += word_count * sizeof(Word);
+        size -= word_count * sizeof(Word);
+        // Tail
+        while (size--)
+        {
+            *dst = byte_op(*dst);
+            dst++;
+        }
+    }
+
+    /**
+     * @brief Apply a byte-wise binary operation to two buffers
+     *
+     * @note Bytes are processed one word at a time.
+     *       Leading and trailing bytes that do not fill a word
+     *       are processed one at a time.
+     *
+     * @tparam WordOp Callable type: Word(Word,Word)
+     * @tparam ByteOp Callable type: uint8_t(uint8_t,uint8_t)
+     * @param dst Buffer holding the first operand and the result
+     * @param src Buffer holding the second operand
+     * @param size Buffer size in bytes
+     * @param word_op Operation on words
+     * @param byte_op Equivalent operation on single bytes
+     */
+    template <typename WordOp, typename ByteOp>
+    void apply(
+        uint8_t *dst,
+        const uint8_t *src,
+        ::std::size_t size,
+        WordOp word_op,
+        ByteOp byte_op) noexcept
+    {
+        // Unaligned head
+        while (size &&
+               (reinterpret_cast<::std::uintptr_t>(dst) % sizeof(Word)))
+        {
+            *dst = byte_op(*dst, *src);
+            dst++;
+            src++;
+            size--;
+        }
+        // Body
+        // Note: memcpy() is used to load from "src",
+        // since it may not be aligned
+        uint8_t *aligned = static_cast<uint8_t *>(
+            __builtin_assume_aligned(dst, sizeof(Word)));
+        ::std::size_t word_count = size / sizeof(Word);
+        for (::std::size_t i = 0; i < word_count; i++)
+        {
+            uint8_t *ptr = aligned + (i * sizeof(Word));
+            store(ptr, word_op(load(ptr), load(src + (i * sizeof(Word)))));
+        }
+        dst += word_count * sizeof(Word);
+        src += word_count * sizeof(Word);
+        size -= word_count * sizeof(Word);
+        // Tail
+        while (size--)
+        {
+            *dst = byte_op(*dst, *src);
+            dst++;
+            src++;
+        }
+    }
+
+    /**
+     * @brief Apply a byte-wise binary operation to two buffers,
+     *        storing the result in a third one
+     *
+     * @note Bytes are processed one word at a time.
+     *       Leading and trailing bytes that do not fill a word
+     *       are processed one at a time.
+     *
+     * @note @p dst may be the same buffer as @p a or @p b
+     *
+     * @tparam WordOp Callable type: Word(Word,Word)
+     * @tparam ByteOp Callable type: uint8_t(uint8_t,uint8_t)
+     * @param dst Buffer holding the result
+     * @param a Buffer holding the first operand
+     * @param b Buffer holding the second operand
+     * @param size Buffer size in bytes
+     * @param word_op Operation on words
+     * @param byte_op Equivalent operation on single bytes
+     */
+    template <typename WordOp, typename ByteOp>
+    void apply(
+        uint8_t *dst,
+        const uint8_t *a,
+        const uint8_t *b,
+        ::std::size_t size,
+        WordOp word_op,
+        ByteOp byte_op) noexcept
+    {
+        // Unaligned head
+        while (size &&
+               (reinterpret_cast<::std::uintptr_t>(dst) % sizeof(Word)))
+        {
+            *dst++ = byte_op(*a++, *b++);
+            size--;
+        }
+        // Body
+        uint8_t *aligned = static_cast<uint8_t *>(
+            __builtin_assume_aligned(dst, sizeof(Word)));
+        ::std::size_t word_count = size / sizeof(Word);
+        for (::std::size_t i = 0; i < word_count; i++)
+        {
+            ::std::size_t offset = i * sizeof(Word);
+            store(
+                aligned + offset,
+                word_op(load(a + offset), load(b + offset)));
+        }
+        dst += word_count * sizeof(Word);
+        a += word_count * sizeof(Word);
+        b += word_count * sizeof(Word);
+        size -= word_count * sizeof(Word);
+        // Tail
+        while (size--)
+            *dst++ = byte_op(*a++, *b++);
+    }
+
+    /**
+     * @brief Fill a buffer of pixels with a single color
+     *
+     * @note Pixels are written one word at a time,
+     *       using a pattern of three words
+     *
+     * @param dst Pointer to the first pixel
+     * @param count Count of pixels
+     * @param color Color
+     */
+    inline void fill(Pixel *dst, ::std::size_t count, const Pixel &color)
+    {
+        // Note: three words hold exactly sizeof(Word) pixels
+        uint8_t pattern[3 * sizeof(Word)];
+        for (::std::size_t i = 0; i < sizeof(Word); i++)
+            ::std::memcpy(
+                pattern + (i * sizeof(Pixel)),
+                &color,
+                sizeof(Pixel));
+        Word w0 = load(pattern);
+        Word w1 = load(pattern + sizeof(Word));
+        Word w2 = load(pattern + (2 * sizeof(Word)));
+        uint8_t *ptr = reinterpret_cast<uint8_t *>(dst);
+        ::std::size_t block_count = count / sizeof(Word);
+        for (::std::size_t i = 0; i < block_count; i++)
+        {
+            store(ptr, w0);
+            store(ptr + sizeof(Word), w1);
+            store(ptr + (2 * sizeof(Word)), w2);
+            ptr += 3 * sizeof(Word);
+        }
+        for (::std::size_t i = block_count * sizeof(Word); i < count; i++)
+            dst[i] = color;
+    }
+
+    //--------------------------------------------------------------------------
+    // Packed RGB <-> pixels
+    //--------------------------------------------------------------------------
+
+    /**
+     * @brief Load a 32-bit value from unaligned memory
+     *
+     * @param ptr Pointer to memory
+     * @return uint32_t Loaded value (native byte order)
+     */
+    inline uint32_t load32(const uint8_t *ptr) noexcept
+    {
+        uint32_t w;
+        ::std::memcpy(&w, ptr, sizeof(w));
+        return w;
+    }
+
+    /**
+     * @brief Store a 32-bit value into unaligned memory
+     *
+     * @param ptr Pointer to memory
+     * @param w Value to be stored (native byte order)
+     */
+    inline void store32(uint8_t *ptr, uint32_t w) noexcept
+    {
+        ::std::memcpy(ptr, &w, sizeof(w));
+    }
+
+    /**
+     * @brief Convert an RGBX quadruplet into a packed RGB value
+     *
+     * @param w Bytes R, G, B and X as loaded by load32()
+     * @return uint32_t Packed RGB value (0xRRGGBB)
+     */
+    inline uint32_t rgbxToPacked(uint32_t w) noexcept
+    {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        return __builtin_bswap32(w) >> 8;
+#else
+        return w >> 8;
+#endif
+    }
+
+    /**
+     * @brief Convert a packed RGB value into an RGBX quadruplet
+     *
+     * @param packedRGB Packed RGB value (0xRRGGBB)
+     * @return uint32_t Bytes R, G, B and zero, to be stored by store32()
+     */
+    inline uint32_t packedToRgbx(uint32_t packedRGB) noexcept
+    {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        return __builtin_bswap32(packedRGB << 8);
+#else
+        return packedRGB << 8;
+#endif
+    }
+
+    /**
+     * @brief Convert 32-bit values into pixels
+     *
+     * @note In little-endian CPUs, a packed RGB value in memory
+     *       is a pixel followed by a padding byte.
+     *       Four values are merged into three words per iteration.
+     *
+     * @tparam Transform Callable type: uint32_t(uint32_t),
+     *         returning a packed RGB value
+     * @param dst Pointer to the first pixel
+     * @param src Pointer to the first 32-bit value (may be unaligned)
+     * @param count Count of pixels
+     * @param transform Conversion of each value into packed RGB
+     */
+    template <typename Transform>
+    void unpackPixels(
+        Pixel *dst,
+        const uint8_t *src,
+        ::std::size_t count,
+        Transform transform) noexcept
+    {
+        ::std::size_t i = 0;
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        uint8_t *ptr = reinterpret_cast<uint8_t *>(dst);
+        for (; (i + 4) <= count; i += 4)
+        {
+            uint32_t w0 = transform(load32(src)) & 0xFFFFFF;
+            uint32_t w1 = transform(load32(src + 4)) & 0xFFFFFF;
+            uint32_t w2 = transform(load32(src + 8)) & 0xFFFFFF;
+            uint32_t w3 = transform(load32(src + 12));
+            store32(ptr, w0 | (w1 << 24));
+            store32(ptr + 4, (w1 >> 8) | (w2 << 16));
+            store32(ptr + 8, (w2 >> 16) | (w3 << 8));
+            src += 16;
+            ptr += 12;
+        }
+#endif
+        for (; i < count; i++)
+        {
+            dst[i] = transform(load32(src));
+            src += 4;
+        }
+    }
+
+    /**
+     * @brief Convert pixels into 32-bit values
+     *
+     * @note Inverse of unpackPixels()
+     *
+     * @tparam Transform Callable type: uint32_t(uint32_t),
+     *         taking a packed RGB value
+     * @param dst Pointer to the first 32-bit value (may be unaligned)
+     * @param src Pointer to the first pixel
+     * @param count Count of pixels
+     * @param transform Conversion of packed RGB into each value
+     */
+    template <typename Transform>
+    void packPixels(
+        uint8_t *dst,
+        const Pixel *src,
+        ::std::size_t count,
+        Transform transform) noexcept
+    {
+        ::std::size_t i = 0;
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        const uint8_t *ptr = reinterpret_cast<const uint8_t *>(src);
+        for (; (i + 4) <= count; i += 4)
+        {
+            uint32_t in0 = load32(ptr);
+            uint32_t in1 = load32(ptr + 4);
+            uint32_t in2 = load32(ptr + 8);
+            store32(dst, transform(in0 & 0xFFFFFF));
+            store32(dst + 4, transform((in0 >> 24) | ((in1 & 0xFFFF) << 8)));
+            store32(dst + 8, transform((in1 >> 16) | ((in2 & 0xFF) << 16)));
+            store32(dst + 12, transform(in2 >> 8));
+            dst += 16;
+            ptr += 12;
+        }
+#endif
+        for (; i < count; i++)
+        {
+            store32(dst, transform(static_cast<uint32_t>(src[i])));
+            dst += 4;
+        }
+    }
+} // namespace PixelMath
@@ -14,12 +14,186 @@
 //------------------------------------------------------------------------------
 
 #include "PixelVector.hpp"
+#include "PixelMath.hpp"
 #include <numeric> // std::gcd()
-#include <numeric> // std::gcd()
+#include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <atomic>
 
 #define Idx(r, c) (((r) * columns) + (c))
 
+//------------------------------------------------------------------------------
+// Globals
+//------------------------------------------------------------------------------
+
+/// @brief Last change generation given to any pixel vector
+static ::std::atomic<uint32_t> last_generation{0};
+
+//------------------------------------------------------------------------------
+// Bulk reductions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Partial sums of a color statistics computation
+ *
+ */
+struct StatisticsAccumulator
+{
+    uint32_t red = 0;
+    uint32_t green = 0;
+    uint32_t blue = 0;
+    uint32_t luminance = 0;
+    uint8_t max_channel = 0;
+    ::std::size_t count = 0;
+
+    /**
+     * @brief Accumulate a contiguous run of pixels
+     *
+     * @note Written as a plain loop with local accumulators
+     *       so the compiler can vectorize it
+     *
+     * @param pixel Pointer to the first pixel
+     * @param count Count of pixels
+     */
+    void add(const Pixel *pixel, ::std::size_t count) noexcept
+    {
+        uint32_t sum_red = 0, sum_green = 0, sum_blue = 0, sum_lum = 0;
+        uint8_t max_ch = max_channel;
+        for (::std::size_t i = 0; i < count; i++)
+        {
+            uint8_t r = pixel[i].red;
+            uint8_t g = pixel[i].green;
+            uint8_t b = pixel[i].blue;
+            uint8_t hi = ::std::max(::std::max(r, g), b);
+            uint8_t lo = ::std::min(::std::min(r, g), b);
+            sum_red += r;
+            sum_green += g;
+            sum_blue += b;
+            sum_lum += hi + lo;
+            max_ch = ::std::max(max_ch, hi);
+        }
+        red += sum_red;
+        green += sum_green;
+        blue += sum_blue;
+        luminance += sum_lum;
+        max_channel = max_ch;
+        this->count += count;
+    }
+
+    /**
+     * @brief Compute the final statistics
+     *
+     * @return PixelStatistics Statistics
+     */
+    PixelStatistics result() const noexcept
+    {
+        PixelStatistics result;
+        if (count > 0)
+        {
+            result.mean.red = red / count;
+            result.mean.green = green / count;
+            result.mean.blue = blue / count;
+            result.luminance = luminance / (2 * count);
+            result.max_channel = max_channel;
+            result.count = count;
+        }
+        return result;
+    }
+};
+
+/**
+ * @brief Accumulate a hue histogram of a contiguous run of pixels
+ *
+ * @param pixel Pointer to the first pixel
+ * @param count Count of pixels
+ * @param histogram Array of counters
+ * @param bin_count Number of counters
+ */
+static void add_to_histogram(
+    const Pixel *pixel,
+    ::std::size_t count,
+    ::std::size_t *histogram,
+    ::std::size_t bin_count) noexcept
+{
+    for (::std::size_t i = 0; i < count; i++)
+        if (pixel[i].max() != pixel[i].min())
+        {
+            unsigned int hue = pixel[i].hue();
+            // Note: Pixel::hue() is negative for hues in [300,360)
+            // if red is the maximum channel
+            if (hue >= 360)
+                hue += 360;
+            histogram[(hue * bin_count) / 360]++;
+        }
+}
+
+/**
+ * @brief Box blur of a line of pixels (in place)
+ *
+ * @note Running sums: the cost per pixel does not depend on the radius.
+ *       The division is replaced by a fixed-point reciprocal.
+ *
+ * @param pixels First pixel in the line
+ * @param count Count of pixels in the line
+ * @param stride Distance between consecutive pixels in the line
+ * @param radius Blur radius
+ * @param scratch Buffer for @p count pixels
+ */
+static void box_blur(
+    Pixel *pixels,
+    PixelVector::size_type count,
+    PixelVector::size_type stride,
+    PixelVector::size_type radius,
+    Pixel *scratch) noexcept
+{
+    if (count < 2)
+        return;
+    for (PixelVector::size_type i = 0; i < count; i++)
+        scratch[i] = pixels[i * stride];
+
+    const ::std::ptrdiff_t last = count - 1;
+    const ::std::ptrdiff_t r = radius;
+    auto clamped = [scratch, last](::std::ptrdiff_t i) -> const Pixel &
+    {
+        return scratch[(i < 0) ? 0 : ((i > last) ? last : i)];
+    };
+    // Note: (sum * reciprocal) >> 24 == sum / divisor
+    // for any sum in the range [0, 255 * divisor] if divisor < 256.
+    // Otherwise, the error is one unit at most.
+    const uint32_t divisor = (2 * radius) + 1;
+    const uint32_t reciprocal = ((1UL << 24) + divisor - 1) / divisor;
+    const uint32_t rounding = divisor / 2;
+
+    // Initial window: r+1 copies of the first pixel,
+    // then the next r pixels (clamped)
+    uint32_t red = (r + 1) * scratch[0].red;
+    uint32_t green = (r + 1) * scratch[0].green;
+    uint32_t blue = (r + 1) * scratch[0].blue;
+    ::std::ptrdiff_t inside = (r < last) ? r : last;
+    for (::std::ptrdiff_t i = 1; i <= inside; i++)
+    {
+        red += scratch[i].red;
+        green += scratch[i].green;
+        blue += scratch[i].blue;
+    }
+    red += (r - inside) * scratch[last].red;
+    green += (r - inside) * scratch[last].green;
+    blue += (r - inside) * scratch[last].blue;
+    for (::std::ptrdiff_t i = 0; i <= last; i++)
+    {
+        Pixel &pixel = pixels[i * stride];
+        pixel.red = ((red + rounding) * reciprocal) >> 24;
+        pixel.green = ((green + rounding) * reciprocal) >> 24;
+        pixel.blue = ((blue + rounding) * reciprocal) >> 24;
+        const Pixel &outgoing = clamped(i - r);
+        const Pixel &incoming = clamped(i + r + 1);
+        red += incoming.red - outgoing.red;
+        green += incoming.green - outgoing.green;
+        blue += incoming.blue - outgoing.blue;
+    }
+}
+
 //------------------------------------------------------------------------------
 // PixelVector
 //------------------------------------------------------------------------------
@@ -33,6 +207,7 @@ void PixelVector::shift(
         from_index = size() - 1;
     if (to_index >= size())
         to_index = size() - 1;
+    markDirty(from_index, to_index);
     if (from_index > to_index)
     {
         // -- Shift down --
@@ -67,7 +242,7 @@ void PixelVector::shift(
     {
         // -- Shift up --
         PixelVector::size_type n = to_index - from_index + 1;
-        PixelVector::size_type equivalent = (n - shift) % n;
+        PixelVector::size_type equivalent = (n - (shift % n)) % n;
         PixelVector::shift(to_index, from_index, equivalent);
     }
 }
@@ -84,10 +259,134 @@ void PixelVector::operator>>(PixelVector::size_type count)
         shift(0, size() - 1, count);
 }
 
+PixelVector::PixelVector(const PixelVector &source)
+    : ::std::vector<Pixel>(source),
+      row_length{source.row_length},
+      change_tracking{source.change_tracking}
+{
+    markDirty();
+}
+
+PixelVector::PixelVector(PixelVector &&source) noexcept
+    : ::std::vector<Pixel>(::std::move(source)),
+      row_length{source.row_length},
+      change_tracking{source.change_tracking}
+{
+    markDirty();
+}
+
+PixelVector &PixelVector::operator=(const PixelVector &source)
+{
+    ::std::vector<Pixel>::operator=(source);
+    row_length = source.row_length;
+    markDirty();
+    return *this;
+}
+
+PixelVector &PixelVector::operator=(PixelVector &&source) noexcept
+{
+    ::std::vector<Pixel>::operator=(::std::move(source));
+    row_length = source.row_length;
+    markDirty();
+    return *this;
+}
+
+void PixelVector::swap(PixelVector &other) noexcept
+{
+    ::std::vector<Pixel>::swap(other);
+    ::std::swap(row_length, other.row_length);
+    markDirty();
+    other.markDirty();
+}
+
+void PixelVector::resize(PixelVector::size_type count, const Pixel &color)
+{
+    ::std::vector<Pixel>::resize(count, color);
+    markDirty();
+}
+
+void PixelVector::trackChanges(bool enable) noexcept
+{
+    change_tracking = enable;
+    dirty_rows.clear();
+    markDirty();
+}
+
+bool PixelVector::dirtyRange(
+    PixelVector::size_type &first,
+    PixelVector::size_type &last) const noexcept
+{
+    if (!change_tracking)
+    {
+        first = 0;
+        last = (size()) ? size() - 1 : 0;
+        return (size() > 0);
+    }
+    // Note: the vector may have shrunk since the last change
+    first = dirty_first;
+    last = ::std::min(dirty_last, (size()) ? size() - 1 : 0);
+    return (first <= last) && (first < size());
+}
+
+bool PixelVector::dirtyRange(
+    uint32_t since,
+    PixelVector::size_type &first,
+    PixelVector::size_type &last) const noexcept
+{
+    if (change_tracking && (since == change_generation))
+        return false;
+    // Note: serial number arithmetic, so generations may wrap around
+    if (change_tracking &&
+        (static_cast<int32_t>(since - clean_generation) >= 0))
+        return dirtyRange(first, last);
+    first = 0;
+    last = (size()) ? size() - 1 : 0;
+    return (size() > 0);
+}
+
+void PixelVector::addDirtyRange(
+    PixelVector::size_type first,
+    PixelVector::size_type last) noexcept
+{
+    if (first > last)
+        ::std::swap(first, last);
+    if (first >= size())
+        return;
+    if (last >= size())
+        last = size() - 1;
+    change_generation = ++last_generation;
+    if (dirty_first > dirty_last)
+    {
+        dirty_first = first;
+        dirty_last = last;
+    }
+    else
+    {
+        dirty_first = ::std::min(dirty_first, first);
+        dirty_last = ::std::max(dirty_last, last);
+    }
+    if (row_length)
+    {
+        dirty_rows.resize(size() / row_length, false);
+        for (size_type row = first / row_length;
+             row <= (last / row_length);
+             row++)
+            dirty_rows[row] = true;
+    }
+}
+
+void PixelVector::markClean() noexcept
+{
+    clean_generation = change_generation;
+    dirty_first = 1;
+    dirty_last = 0;
+    dirty_rows.assign(dirty_rows.size(), false);
+}
+
 void PixelVector::fill(const Pixel &color)
 {
-    for (size_type i = 0; i < this->size(); i++)
-        (*this)[i] = color;
+    PixelMath::fill(data(), size(), color);
+    markDirty();
 }
 
 void PixelVector::fill(
@@ -95,15 +394,238 @@ void PixelVector::fill(
     PixelVector::size_type fromIndex,
     PixelVector::size_type toIndex)
 {
-    if (fromIndex <= toIndex)
-        for (size_type i = fromIndex;
-             (i < this->size()) && (i <= toIndex);
-             i++)
+    if (fromIndex > toIndex)
+        ::std::swap(fromIndex, toIndex);
+    if (fromIndex < size())
+    {
+        if (toIndex >= size())
+            toIndex = size() - 1;
+        PixelMath::fill(data() + fromIndex, toIndex - fromIndex + 1, color);
+        markDirty(fromIndex, toIndex);
+    }
+}
+
+void PixelVector::scale(uint8_t factor) noexcept
+{
+    uint16_t f = factor + 1;
+    PixelMath::apply(
+        reinterpret_cast<uint8_t *>(data()),
+        size() * sizeof(Pixel),
+        [f](PixelMath::Word w)
+        { return PixelMath::scale(w, f); },
+        [f](uint8_t b) -> uint8_t
+        { return (b * f) >> 8; });
+    markDirty();
+}
+
+void PixelVector::blendAdd(const PixelVector &other) noexcept
+{
+    size_type count = ::std::min(size(), other.size());
+    PixelMath::apply(
+        reinterpret_cast<uint8_t *>(data()),
+        reinterpret_cast<const uint8_t *>(other.data()),
+        count * sizeof(Pixel),
+        PixelMath::addSaturated,
+        [](uint8_t a, uint8_t b) -> uint8_t
+        { return ((a + b) > 255) ? 255 : (a + b); });
+    if (count)
+        markDirty(0, count - 1);
+}
+
+void PixelVector::blendMax(const PixelVector &other) noexcept
+{
+    size_type count = ::std::min(size(), other.size());
+    PixelMath::apply(
+        reinterpret_cast<uint8_t *>(data()),
+        reinterpret_cast<const uint8_t *>(other.data()),
+        count * sizeof(Pixel),
+        PixelMath::maximum,
+        [](uint8_t a, uint8_t b) -> uint8_t
+        { return (a > b) ? a : b; });
+    if (count)
+        markDirty(0, count - 1);
+}
+
+void PixelVector::crossfade(
+    const PixelVector &from,
+    const PixelVector &to,
+    uint8_t amount) noexcept
+{
+    size_type count = ::std::min({size(), from.size(), to.size()});
+    uint16_t w = PixelMath::blendWeight(amount);
+    PixelMath::apply(
+        reinterpret_cast<uint8_t *>(data()),
+        reinterpret_cast<const uint8_t *>(from.data()),
+        reinterpret_cast<const uint8_t *>(to.data()),
+        count * sizeof(Pixel),
+        [w](PixelMath::Word a, PixelMath::Word b)
+        { return PixelMath::blend(a, b, w); },
+        [w](uint8_t a, uint8_t b) -> uint8_t
+        { return ((a * (256 - w)) + (b * w)) >> 8; });
+    if (count)
+        markDirty(0, count - 1);
+}
+
+void PixelVector::lerpTowards(const PixelVector &target, uint8_t step) noexcept
+{
+    size_type count = ::std::min(size(), target.size());
+    uint16_t w = PixelMath::blendWeight(step);
+    PixelMath::apply(
+        reinterpret_cast<uint8_t *>(data()),
+        reinterpret_cast<const uint8_t *>(target.data()),
+        count * sizeof(Pixel),
+        [w](PixelMath::Word a, PixelMath::Word b)
+        { return PixelMath::towards(a, b, w); },
+        [w](uint8_t a, uint8_t b) -> uint8_t
         {
-            (*this)[i] = color;
-        }
-    else
-        fill(color, toIndex, fromIndex);
+            if ((w == 0) || (a == b))
+                return a;
+            int delta = (((int)b - a) * w) / 256;
+            if (delta == 0)
+                delta = (b > a) ? 1 : -1;
+            return a + delta;
+        });
+    if (count)
+        markDirty(0, count - 1);
+}
+
+void PixelVector::assignPacked(
+    const uint32_t *packed,
+    size_type count) noexcept
+{
+    count = ::std::min(size(), count);
+    PixelMath::unpackPixels(
+        data(),
+        reinterpret_cast<const uint8_t *>(packed),
+        count,
+        [](uint32_t w)
+        { return w; });
+    if (count)
+        markDirty(0, count - 1);
+}
+
+void PixelVector::exportPacked(uint32_t *packed) const noexcept
+{
+    PixelMath::packPixels(
+        reinterpret_cast<uint8_t *>(packed),
+        data(),
+        size(),
+        [](uint32_t w)
+        { return w; });
+}
+
+void PixelVector::assignRGBX(const uint8_t *rgbx, size_type count) noexcept
+{
+    count = ::std::min(size(), count);
+    PixelMath::unpackPixels(data(), rgbx, count, PixelMath::rgbxToPacked);
+    if (count)
+        markDirty(0, count - 1);
+}
+
+void PixelVector::exportRGBX(uint8_t *rgbx) const noexcept
+{
+    PixelMath::packPixels(
+        rgbx,
+        data(),
+        size(),
+        PixelMath::packedToRgbx);
+}
+
+void PixelVector::boxBlur(PixelVector::size_type radius) noexcept
+{
+    if ((radius == 0) || (size() < 2))
+        return;
+    ::std::vector<Pixel> scratch(size());
+    box_blur(data(), size(), 1, radius, scratch.data());
+    markDirty();
+}
+
+void PixelVector::gaussianBlur(PixelVector::size_type radius) noexcept
+{
+    if ((radius == 0) || (size() < 2))
+        return;
+    ::std::vector<Pixel> scratch(size());
+    for (int pass = 0; pass < 3; pass++)
+        box_blur(data(), size(), 1, radius, scratch.data());
+    markDirty();
+}
+
+void PixelVector::fillHue(
+    uint16_t hue,
+    uint8_t saturation,
+    uint8_t luminance) noexcept
+{
+    Pixel color;
+    color.hsl16(hue, saturation, luminance);
+    fill(color);
+}
+
+void PixelVector::fillRainbow(
+    uint16_t startHue,
+    uint16_t deltaHue,
+    uint8_t saturation,
+    uint8_t luminance) noexcept
+{
+    PixelMath::HslTerms terms = PixelMath::hslTerms(saturation, luminance);
+    uint16_t hue = startHue;
+    Pixel *pixel = data();
+    for (size_type i = 0; i < size(); i++)
+    {
+        PixelMath::hsl16(pixel[i], hue, terms);
+        hue += deltaHue; // Note: wraps around at 360 degrees
+    }
+    markDirty();
+}
+
+PixelStatistics PixelVector::statistics() const noexcept
+{
+    StatisticsAccumulator acc;
+    acc.add(data(), size());
+    return acc.result();
+}
+
+PixelStatistics PixelVector::statistics(
+    PixelVector::size_type fromIndex,
+    PixelVector::size_type toIndex) const noexcept
+{
+    if (fromIndex > toIndex)
+        ::std::swap(fromIndex, toIndex);
+    StatisticsAccumulator acc;
+    if (fromIndex < size())
+    {
+        if (toIndex >= size())
+            toIndex = size() - 1;
+        acc.add(data() + fromIndex, toIndex - fromIndex + 1);
+    }
+    return acc.result();
+}
+
+void PixelVector::hueHistogram(
+    ::std::size_t *histogram,
+    ::std::size_t bin_count) const noexcept
+{
+    if (histogram && bin_count)
+        add_to_histogram(data(), size(), histogram, bin_count);
+}
+
+void PixelVector::hueHistogram(
+    ::std::size_t *histogram,
+    ::std::size_t bin_count,
+    PixelVector::size_type fromIndex,
+    PixelVector::size_type toIndex) const noexcept
+{
+    if (fromIndex > toIndex)
+        ::std::swap(fromIndex, toIndex);
+    if (histogram && bin_count && (fromIndex < size()))
+    {
+        if (toIndex >= size())
+            toIndex = size() - 1;
+        add_to_histogram(
+            data() + fromIndex,
+            toIndex - fromIndex + 1,
+            histogram,
+            bin_count);
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -123,6 +645,7 @@ PixelMatrix::PixelMatrix(
     Pixel color) noexcept : rows{rows}, columns{columns}
 {
     PixelVector::resize(rows * columns, color);
+    row_length = columns;
 }
 
 PixelMatrix::PixelMatrix(
@@ -139,6 +662,24 @@ void PixelMatrix::resize(
     PixelVector::resize(rows * columns, color);
     this->rows = rows;
     this->columns = columns;
+    row_length = columns;
+    markDirty();
+}
+
+PixelMatrix &PixelMatrix::operator=(const PixelMatrix &source) noexcept
+{
+    PixelVector::operator=(source);
+    rows = source.rows;
+    columns = source.columns;
+    return *this;
+}
+
+PixelMatrix &PixelMatrix::operator=(PixelMatrix &&source) noexcept
+{
+    PixelVector::operator=(::std::move(source));
+    rows = source.rows;
+    columns = source.columns;
+    return *this;
 }
 
 PixelMatrix &PixelMatrix::operator=(
@@ -152,6 +693,7 @@ PixelMatrix &PixelMatrix::operator=(
 
     // Resize
     rows = init_list.size();
+    row_length = columns;
     PixelVector::resize(rows * columns);
 
     // Copy pixels
@@ -166,6 +708,7 @@ PixelMatrix &PixelMatrix::operator=(
         }
         row++;
     }
+    markDirty();
     return *this;
 }
 
@@ -185,42 +728,891 @@ const Pixel &PixelMatrix::at(
 
 void PixelMatrix::fill(const Pixel &color) noexcept
 {
-    for (PixelMatrix::size_type i = 0; i < size(); i++)
-        (*this)[i] = color;
+    PixelVector::fill(color);
+}
+
+void PixelMatrix::boxBlur(PixelMatrix::size_type radius) noexcept
+{
+    if ((radius == 0) || (size() == 0))
+        return;
+    ::std::vector<Pixel> scratch(::std::max(rows, columns));
+    for (size_type r = 0; r < rows; r++)
+        box_blur(data() + Idx(r, 0), columns, 1, radius, scratch.data());
+    for (size_type c = 0; c < columns; c++)
+        box_blur(data() + c, rows, columns, radius, scratch.data());
+    markDirty();
+}
+
+void PixelMatrix::gaussianBlur(PixelMatrix::size_type radius) noexcept
+{
+    if ((radius == 0) || (size() == 0))
+        return;
+    ::std::vector<Pixel> scratch(::std::max(rows, columns));
+    for (size_type r = 0; r < rows; r++)
+        for (int pass = 0; pass < 3; pass++)
+            box_blur(data() + Idx(r, 0), columns, 1, radius, scratch.data());
+    for (size_type c = 0; c < columns; c++)
+        for (int pass = 0; pass < 3; pass++)
+            box_blur(data() + c, rows, columns, radius, scratch.data());
+    markDirty();
 }
 
 void PixelMatrix::operator<<(PixelMatrix::size_type count) noexcept
 {
-    if ((rows > 0) && (columns > 1))
+    scroll(ScrollDirection::left, count, bounds());
+}
+
+void PixelMatrix::operator>>(PixelMatrix::size_type count) noexcept
+{
+    scroll(ScrollDirection::right, count, bounds());
+}
+
+void PixelMatrix::scroll_up(PixelMatrix::size_type count) noexcept
+{
+    scroll(ScrollDirection::up, count, bounds());
+}
+
+void PixelMatrix::scroll_down(PixelMatrix::size_type count) noexcept
+{
+    scroll(ScrollDirection::down, count, bounds());
+}
+
+/**
+ * @brief Clip a rectangular area to the bounds of a matrix
+ *
+ * @param area Area to be clipped
+ * @param rows Number of rows in the matrix
+ * @param columns Number of columns in the matrix
+ * @return PixelRect Clipped area (may be empty)
+ */
+static PixelRect clip(
+    const PixelRect &area,
+    PixelMatrix::size_type rows,
+    PixelMatrix::size_type columns) noexcept
+{
+    PixelRect result;
+    if ((area.row < rows) && (area.column < columns))
     {
-        count = count % columns; // optimization
-        for (PixelMatrix::size_type row = 0; row < rows; row++)
-            shift(Idx(row, columns - 1), Idx(row, 0), count);
+        result.row = area.row;
+        result.column = area.column;
+        result.row_count = ::std::min(area.row_count, rows - area.row);
+        result.column_count =
+            ::std::min(area.column_count, columns - area.column);
     }
+    return result;
 }
 
-void PixelMatrix::operator>>(PixelMatrix::size_type count) noexcept
+/**
+ * @brief Copy a rectangular block of pixels between two buffers
+ *
+ * @param dst Pointer to the top-left pixel of the destination block
+ * @param dst_stride Row length of the destination buffer
+ * @param src Pointer to the top-left pixel of the source block
+ * @param src_stride Row length of the source buffer
+ * @param row_count Number of rows in the block
+ * @param column_count Number of columns in the block
+ */
+static void copy_block(
+    Pixel *dst,
+    PixelMatrix::size_type dst_stride,
+    const Pixel *src,
+    PixelMatrix::size_type src_stride,
+    PixelMatrix::size_type row_count,
+    PixelMatrix::size_type column_count) noexcept
+{
+    if ((dst_stride == column_count) && (src_stride == column_count))
+        ::std::memmove(dst, src, row_count * column_count * sizeof(Pixel));
+    else
+        for (PixelMatrix::size_type row = 0; row < row_count; row++)
+            ::std::memmove(
+                dst + (row * dst_stride),
+                src + (row * src_stride),
+                column_count * sizeof(Pixel));
+}
+
+/**
+ * @brief Reverse the order of some row segments in place
+ *
+ * @param base Pointer to the first pixel of the first row segment
+ * @param stride Row length of the buffer
+ * @param column_count Length of each row segment
+ * @param first First row segment to reverse
+ * @param last Row segment past the last one to reverse
+ */
+static void reverse_rows(
+    Pixel *base,
+    PixelMatrix::size_type stride,
+    PixelMatrix::size_type column_count,
+    PixelMatrix::size_type first,
+    PixelMatrix::size_type last) noexcept
 {
-    if ((rows > 0) && (columns > 1))
+    for (; (first + 1) < last; first++, last--)
+        ::std::swap_ranges(
+            base + (first * stride),
+            base + (first * stride) + column_count,
+            base + ((last - 1) * stride));
+}
+
+/**
+ * @brief Rotate row segments up in place
+ *
+ * @note No buffers: contiguous rows are rotated as a whole,
+ *       otherwise, row segments are swapped (three reversals)
+ *
+ * @param base Pointer to the first pixel of the first row segment
+ * @param stride Row length of the buffer
+ * @param row_count Number of row segments
+ * @param column_count Length of each row segment
+ * @param count Rotation count (less than @p row_count)
+ */
+static void rotate_rows(
+    Pixel *base,
+    PixelMatrix::size_type stride,
+    PixelMatrix::size_type row_count,
+    PixelMatrix::size_type column_count,
+    PixelMatrix::size_type count) noexcept
+{
+    if (stride == column_count)
+        ::std::rotate(
+            base,
+            base + (count * column_count),
+            base + (row_count * column_count));
+    else
     {
-        count = count % columns; // optimization
-        for (PixelMatrix::size_type row = 0; row < rows; row++)
-            shift(Idx(row, 0), Idx(row, columns - 1), count);
+        reverse_rows(base, stride, column_count, 0, count);
+        reverse_rows(base, stride, column_count, count, row_count);
+        reverse_rows(base, stride, column_count, 0, row_count);
     }
 }
 
-void PixelMatrix::scroll_up(PixelMatrix::size_type count) noexcept
+void PixelMatrix::scroll(
+    ScrollDirection direction,
+    PixelMatrix::size_type count,
+    const PixelRect &area) noexcept
 {
-    if ((rows > 1) && (columns > 0))
+    scrollArea(direction, count, area, nullptr, nullptr, 0, 0);
+}
+
+void PixelMatrix::scroll(
+    ScrollDirection direction,
+    PixelMatrix::size_type count,
+    const PixelRect &area,
+    const Pixel &color) noexcept
+{
+    scrollArea(direction, count, area, &color, nullptr, 0, 0);
+}
+
+void PixelMatrix::scroll(
+    ScrollDirection direction,
+    PixelMatrix::size_type count,
+    const PixelRect &area,
+    const PixelMatrix &source,
+    PixelMatrix::size_type source_row,
+    PixelMatrix::size_type source_column) noexcept
+{
+    scrollArea(
+        direction,
+        count,
+        area,
+        nullptr,
+        &source,
+        source_row,
+        source_column);
+}
+
+void PixelMatrix::scrollArea(
+    ScrollDirection direction,
+    PixelMatrix::size_type count,
+    const PixelRect &area,
+    const Pixel *color,
+    const PixelMatrix *source,
+    PixelMatrix::size_type source_row,
+    PixelMatrix::size_type source_column) noexcept
+{
+    PixelRect rect = clip(area, rows, columns);
+    bool vertical =
+        (direction == ScrollDirection::up) ||
+        (direction == ScrollDirection::down);
+    size_type length = (vertical) ? rect.row_count : rect.column_count;
+    if ((rect.row_count == 0) || (rect.column_count == 0))
+        return;
+    if (!color && !source)
+        count = count % length;
+    else if (count > length)
+        count = length;
+    if (count == 0)
+        return;
+    markDirty(rect);
+
+    // Wrap mode: rotate in place, without buffers
+    if (!color && !source)
+    {
+        Pixel *base = data() + Idx(rect.row, rect.column);
+        bool backwards =
+            (direction == ScrollDirection::down) ||
+            (direction == ScrollDirection::right);
+        size_type shift = (backwards) ? (length - count) : count;
+        if (vertical)
+            rotate_rows(
+                base,
+                columns,
+                rect.row_count,
+                rect.column_count,
+                shift);
+        else
+            for (size_type row = 0; row < rect.row_count; row++)
+            {
+                Pixel *first = base + (row * columns);
+                ::std::rotate(first, first + shift, first + rect.column_count);
+            }
+        return;
+    }
+
+    // Incoming block
+    PixelRect incoming = rect;
+    if (vertical)
+    {
+        incoming.row_count = count;
+        if (direction == ScrollDirection::up)
+            incoming.row += rect.row_count - count;
+    }
+    else
+    {
+        incoming.column_count = count;
+        if (direction == ScrollDirection::left)
+            incoming.column += rect.column_count - count;
+    }
+
+    // Feeding from this matrix: copy the incoming pixels, only,
+    // before they are overwritten
+    PixelMatrix buffer;
+    if (source == this)
+    {
+        size_type buffer_rows =
+            (source_row < rows)
+                ? ::std::min(incoming.row_count, rows - source_row)
+                : 0;
+        size_type buffer_columns =
+            (source_column < columns)
+                ? ::std::min(incoming.column_count, columns - source_column)
+                : 0;
+        buffer.resize(buffer_rows, buffer_columns);
+        if (buffer_rows && buffer_columns)
+            copy_block(
+                buffer.data(),
+                buffer_columns,
+                data() + Idx(source_row, source_column),
+                columns,
+                buffer_rows,
+                buffer_columns);
+        source = &buffer;
+        source_row = 0;
+        source_column = 0;
+    }
+
+    // Move the remaining block
+    // Note: memmove() allows overlapping
+    size_type moved_rows = rect.row_count;
+    size_type moved_columns = rect.column_count;
+    size_type from_row = rect.row;
+    size_type from_column = rect.column;
+    size_type to_row = rect.row;
+    size_type to_column = rect.column;
+    switch (direction)
     {
-        shift(size() - 1, 0, (count * columns));
+    case ScrollDirection::up:
+        moved_rows -= count;
+        from_row += count;
+        break;
+    case ScrollDirection::down:
+        moved_rows -= count;
+        to_row += count;
+        break;
+    case ScrollDirection::left:
+        moved_columns -= count;
+        from_column += count;
+        break;
+    case ScrollDirection::right:
+        moved_columns -= count;
+        to_column += count;
+        break;
+    }
+    if ((moved_rows > 0) && (moved_columns > 0))
+    {
+        if (direction == ScrollDirection::down)
+            // Note: rows are moved backwards, so they are not overwritten
+            for (size_type row = moved_rows; row > 0; row--)
+                ::std::memmove(
+                    data() + Idx(to_row + row - 1, to_column),
+                    data() + Idx(from_row + row - 1, from_column),
+                    moved_columns * sizeof(Pixel));
+        else
+            copy_block(
+                data() + Idx(to_row, to_column),
+                columns,
+                data() + Idx(from_row, from_column),
+                columns,
+                moved_rows,
+                moved_columns);
+    }
+
+    // Fill the incoming block
+    for (size_type row = 0; row < incoming.row_count; row++)
+    {
+        Pixel *dst = data() + Idx(incoming.row + row, incoming.column);
+        size_type available = 0;
+        if (source &&
+            ((source_row + row) < source->rows) &&
+            (source_column < source->columns))
+        {
+            available = ::std::min(
+                incoming.column_count,
+                source->columns - source_column);
+            ::std::memcpy(
+                dst,
+                source->data() +
+                    ((source_row + row) * source->columns) + source_column,
+                available * sizeof(Pixel));
+        }
+        PixelMath::fill(
+            dst + available,
+            incoming.column_count - available,
+            (color) ? *color : Pixel());
     }
 }
 
-void PixelMatrix::scroll_down(PixelMatrix::size_type count) noexcept
+void PixelMatrix::blit(
+    const PixelMatrix &source,
+    const PixelRect &area,
+    ::std::ptrdiff_t row,
+    ::std::ptrdiff_t column) noexcept
+{
+    blitArea(source, area, row, column, nullptr, nullptr);
+}
+
+void PixelMatrix::blit(
+    const PixelMatrix &source,
+    const PixelRect &area,
+    ::std::ptrdiff_t row,
+    ::std::ptrdiff_t column,
+    const Pixel &color_key) noexcept
+{
+    blitArea(source, area, row, column, &color_key, nullptr);
+}
+
+void PixelMatrix::blit(
+    const PixelMatrix &source,
+    const PixelRect &area,
+    ::std::ptrdiff_t row,
+    ::std::ptrdiff_t column,
+    const ::std::vector<bool> &mask) noexcept
+{
+    blitArea(source, area, row, column, nullptr, &mask);
+}
+
+void PixelMatrix::blitArea(
+    const PixelMatrix &source,
+    const PixelRect &area,
+    ::std::ptrdiff_t row,
+    ::std::ptrdiff_t column,
+    const Pixel *color_key,
+    const ::std::vector<bool> *mask) noexcept
+{
+    // Clip to the source bounds
+    PixelRect from = clip(area, source.rows, source.columns);
+    // Clip to the destination bounds
+    if (row < 0)
+    {
+        size_type skip = -row;
+        from.row += skip;
+        from.row_count -= ::std::min(skip, from.row_count);
+        row = 0;
+    }
+    if (column < 0)
+    {
+        size_type skip = -column;
+        from.column += skip;
+        from.column_count -= ::std::min(skip, from.column_count);
+        column = 0;
+    }
+    if ((static_cast<size_type>(row) >= rows) ||
+        (static_cast<size_type>(column) >= columns))
+        return;
+    from.row_count = ::std::min(from.row_count, rows - row);
+    from.column_count = ::std::min(from.column_count, columns - column);
+    if ((from.row_count == 0) || (from.column_count == 0))
+        return;
+
+    // Note: source and destination may overlap if they are the same matrix.
+    // No copies: rows are moved bottom-up when moving down and runs are
+    // moved right to left when moving right, so they are not overwritten.
+    bool self = (&source == this);
+    bool bottom_up = self && (static_cast<size_type>(row) > from.row);
+    bool right_to_left =
+        self && (static_cast<size_type>(column) > from.column);
+    markDirty(PixelRect{
+        static_cast<size_type>(row),
+        static_cast<size_type>(column),
+        from.row_count,
+        from.column_count});
+
+    for (size_type i = 0; i < from.row_count; i++)
+    {
+        size_type r = (bottom_up) ? (from.row_count - 1 - i) : i;
+        size_type src_index = ((from.row + r) * source.columns) + from.column;
+        const Pixel *src_row = source.data() + src_index;
+        Pixel *dst_row = data() + Idx(row + r, column);
+        if (!color_key && !mask)
+        {
+            ::std::memmove(dst_row, src_row, from.column_count * sizeof(Pixel));
+            continue;
+        }
+        // Copy runs of opaque pixels
+        auto opaque = [&](size_type col) -> bool
+        {
+            if (color_key)
+                return (src_row[col] != *color_key);
+            size_type bit = src_index + col;
+            return (bit < mask->size()) && (*mask)[bit];
+        };
+        size_type c = (right_to_left) ? from.column_count : 0;
+        while ((right_to_left) ? (c > 0) : (c < from.column_count))
+        {
+            size_type run_start, run_end;
+            if (right_to_left)
+            {
+                while ((c > 0) && !opaque(c - 1))
+                    c--;
+                run_end = c;
+                while ((c > 0) && opaque(c - 1))
+                    c--;
+                run_start = c;
+            }
+            else
+            {
+                while ((c < from.column_count) && !opaque(c))
+                    c++;
+                run_start = c;
+                while ((c < from.column_count) && opaque(c))
+                    c++;
+                run_end = c;
+            }
+            if (run_end > run_start)
+                ::std::memmove(
+                    dst_row + run_start,
+                    src_row + run_start,
+                    (run_end - run_start) * sizeof(Pixel));
+        }
+    }
+}
+
+/**
+ * @brief Resample using the nearest neighbor
+ *
+ * @note 16.16 fixed-point stepping, sampling at pixel centers.
+ */
+static void resample_nearest(
+    const Pixel *source,
+    PixelMatrix::size_type source_rows,
+    PixelMatrix::size_type source_columns,
+    Pixel *target,
+    PixelMatrix::size_type rows,
+    PixelMatrix::size_type columns) noexcept
+{
+    uint32_t row_step = (source_rows << 16) / rows;
+    uint32_t column_step = (source_columns << 16) / columns;
+    ::std::vector<PixelMatrix::size_type> column_index(columns);
+    uint32_t position = column_step / 2;
+    for (PixelMatrix::size_type c = 0; c < columns; c++)
+    {
+        column_index[c] = position >> 16;
+        position += column_step;
+    }
+    position = row_step / 2;
+    for (PixelMatrix::size_type r = 0; r < rows; r++)
+    {
+        const Pixel *source_row = source + ((position >> 16) * source_columns);
+        for (PixelMatrix::size_type c = 0; c < columns; c++)
+            *target++ = source_row[column_index[c]];
+        position += row_step;
+    }
+}
+
+/**
+ * @brief Pair of neighbor pixels and interpolation weight
+ *
+ */
+struct BilinearSample
+{
+    PixelMatrix::size_type first;
+    PixelMatrix::size_type second;
+    uint8_t weight;
+};
+
+/**
+ * @brief Compute the bilinear samples along one dimension
+ *
+ * @note 16.16 fixed-point stepping. Pixel centers are aligned.
+ */
+static void bilinear_samples(
+    PixelMatrix::size_type source_count,
+    ::std::vector<BilinearSample> &samples) noexcept
+{
+    int32_t step = (source_count << 16) / samples.size();
+    int32_t position = (step / 2) - 0x8000;
+    for (BilinearSample &sample : samples)
+    {
+        int32_t clamped = (position < 0) ? 0 : position;
+        sample.first = clamped >> 16;
+        sample.second = ::std::min(sample.first + 1, source_count - 1);
+        sample.weight = (clamped >> 8) & 0xFF;
+        position += step;
+    }
+}
+
+/**
+ * @brief Resample using linear interpolation of four pixels
+ *
+ * @note Separable: vertical interpolation, then horizontal.
+ */
+static void resample_bilinear(
+    const Pixel *source,
+    PixelMatrix::size_type source_rows,
+    PixelMatrix::size_type source_columns,
+    Pixel *target,
+    PixelMatrix::size_type rows,
+    PixelMatrix::size_type columns) noexcept
+{
+    ::std::vector<BilinearSample> row_samples(rows);
+    ::std::vector<BilinearSample> column_samples(columns);
+    bilinear_samples(source_rows, row_samples);
+    bilinear_samples(source_columns, column_samples);
+    // Note: rows are interpolated first into a scratch row
+    ::std::vector<Pixel> line(source_columns);
+    for (const BilinearSample &row : row_samples)
+    {
+        const Pixel *source_row = source + (row.first * source_columns);
+        if (row.weight)
+        {
+            const Pixel *bottom = source + (row.second * source_columns);
+            for (PixelMatrix::size_type c = 0; c < source_columns; c++)
+            {
+                line[c] = source_row[c];
+                line[c].blend(bottom[c], row.weight);
+            }
+            source_row = line.data();
+        }
+        for (const BilinearSample &column : column_samples)
+        {
+            *target = source_row[column.first];
+            target->blend(source_row[column.second], column.weight);
+            target++;
+        }
+    }
+}
+
+/**
+ * @brief Compute the source bounds of each box along one dimension
+ *
+ * @note bounds[i] = floor(i * source_count / count),
+ *       computed incrementally without division.
+ */
+static void box_bounds(
+    PixelMatrix::size_type source_count,
+    ::std::vector<PixelMatrix::size_type> &bounds) noexcept
+{
+    PixelMatrix::size_type count = bounds.size() - 1;
+    PixelMatrix::size_type quotient = source_count / count;
+    PixelMatrix::size_type remainder = source_count % count;
+    PixelMatrix::size_type value = 0;
+    PixelMatrix::size_type error = 0;
+    for (PixelMatrix::size_type &bound : bounds)
+    {
+        bound = value;
+        value += quotient;
+        error += remainder;
+        if (error >= count)
+        {
+            value++;
+            error -= count;
+        }
+    }
+}
+
+/**
+ * @brief Resample using the average of the covered source pixels
+ *
+ * @note Every target pixel covers one source pixel at least.
+ */
+static void resample_box(
+    const Pixel *source,
+    PixelMatrix::size_type source_rows,
+    PixelMatrix::size_type source_columns,
+    Pixel *target,
+    PixelMatrix::size_type rows,
+    PixelMatrix::size_type columns) noexcept
+{
+    ::std::vector<PixelMatrix::size_type> row_bounds(rows + 1);
+    ::std::vector<PixelMatrix::size_type> column_bounds(columns + 1);
+    box_bounds(source_rows, row_bounds);
+    box_bounds(source_columns, column_bounds);
+    for (PixelMatrix::size_type r = 0; r < rows; r++)
+    {
+        PixelMatrix::size_type first_row = row_bounds[r];
+        PixelMatrix::size_type last_row =
+            ::std::max(row_bounds[r + 1], first_row + 1);
+        for (PixelMatrix::size_type c = 0; c < columns; c++)
+        {
+            PixelMatrix::size_type first_column = column_bounds[c];
+            PixelMatrix::size_type last_column =
+                ::std::max(column_bounds[c + 1], first_column + 1);
+            uint32_t red = 0;
+            uint32_t green = 0;
+            uint32_t blue = 0;
+            for (PixelMatrix::size_type sr = first_row; sr < last_row; sr++)
+            {
+                const Pixel *pixel = source + (sr * source_columns);
+                for (PixelMatrix::size_type sc = first_column;
+                     sc < last_column;
+                     sc++)
+                {
+                    red += pixel[sc].red;
+                    green += pixel[sc].green;
+                    blue += pixel[sc].blue;
+                }
+            }
+            uint32_t count =
+                (last_row - first_row) * (last_column - first_column);
+            target->red = (red + (count / 2)) / count;
+            target->green = (green + (count / 2)) / count;
+            target->blue = (blue + (count / 2)) / count;
+            target++;
+        }
+    }
+}
+
+void PixelMatrix::resample(
+    const PixelMatrix &source,
+    ResampleFilter filter) noexcept
+{
+    if (size() == 0)
+        return;
+    if (source.size() == 0)
+    {
+        fill(Pixel());
+        return;
+    }
+    // Note: 16.16 fixed-point positions
+    assert((source.rows < 0x8000) && (source.columns < 0x8000));
+    assert((rows < 0x8000) && (columns < 0x8000));
+
+    PixelMatrix buffer;
+    const PixelMatrix *src = &source;
+    if (src == this)
+    {
+        buffer = source;
+        src = &buffer;
+    }
+    markDirty();
+
+    switch (filter)
+    {
+    case ResampleFilter::nearest:
+        resample_nearest(
+            src->data(), src->rows, src->columns, data(), rows, columns);
+        break;
+    case ResampleFilter::box:
+        resample_box(
+            src->data(), src->rows, src->columns, data(), rows, columns);
+        break;
+    default:
+        resample_bilinear(
+            src->data(), src->rows, src->columns, data(), rows, columns);
+        break;
+    }
+}
+
+PixelRect PixelMatrix::mirrorArea(Symmetry symmetry) const noexcept
+{
+    // Note: the central row or column (odd sizes) belongs to the area
+    size_type half_rows = (rows + 1) / 2;
+    size_type half_columns = (columns + 1) / 2;
+    switch (symmetry)
+    {
+    case Symmetry::horizontal:
+        return PixelRect{0, 0, rows, half_columns};
+    case Symmetry::vertical:
+        return PixelRect{0, 0, half_rows, columns};
+    default:
+        return PixelRect{0, 0, half_rows, half_columns};
+    }
+}
+
+void PixelMatrix::mirror(Symmetry symmetry) noexcept
+{
+    if (size() == 0)
+        return;
+    size_type half_rows = (rows + 1) / 2;
+    size_type half_columns = (columns + 1) / 2;
+    Pixel *pixels = data();
+
+    if (symmetry == Symmetry::octant)
+    {
+        // Lower triangle of the top-left quarter: transpose
+        size_type n = ::std::min(half_rows, half_columns);
+        for (size_type r = 1; r < n; r++)
+            for (size_type c = 0; c < r; c++)
+                pixels[Idx(r, c)] = pixels[Idx(c, r)];
+        markDirty(PixelRect{1, 0, n - 1, n - 1});
+    }
+
+    bool mirror_columns = (symmetry != Symmetry::vertical);
+    bool mirror_rows = (symmetry != Symmetry::horizontal);
+    size_type source_rows = mirror_rows ? half_rows : rows;
+    if (mirror_columns)
+    {
+        // Right half: reversed copy of the left half
+        size_type count = columns / 2;
+        for (size_type r = 0; r < source_rows; r++)
+        {
+            Pixel *row = pixels + Idx(r, 0);
+            ::std::reverse_copy(row, row + count, row + columns - count);
+        }
+        markDirty(PixelRect{0, columns - count, source_rows, count});
+    }
+    if (mirror_rows)
+    {
+        // Bottom half: copy of the top half in reverse row order
+        size_type count = rows / 2;
+        for (size_type r = 0; r < count; r++)
+            ::std::memcpy(
+                pixels + Idx(rows - 1 - r, 0),
+                pixels + Idx(r, 0),
+                columns * sizeof(Pixel));
+        markDirty(PixelRect{rows - count, 0, count, columns});
+    }
+}
+
+/// @brief Width and height of the blocks moved by PixelMatrix::transpose()
+static constexpr PixelMatrix::size_type transpose_block = 16;
+
+void PixelMatrix::transpose() noexcept
+{
+    Pixel *pixels = data();
+    if (rows == columns)
+    {
+        // Note: swap each block above the diagonal with its mirror
+        for (size_type br = 0; br < rows; br += transpose_block)
+        {
+            size_type r_end = ::std::min(br + transpose_block, rows);
+            for (size_type bc = br; bc < columns; bc += transpose_block)
+            {
+                size_type c_end = ::std::min(bc + transpose_block, columns);
+                for (size_type r = br; r < r_end; r++)
+                    for (size_type c = ::std::max(bc, r + 1); c < c_end; c++)
+                        ::std::swap(pixels[Idx(r, c)], pixels[Idx(c, r)]);
+            }
+        }
+    }
+    else if (size())
+    {
+        ::std::vector<Pixel> result(size());
+        for (size_type br = 0; br < rows; br += transpose_block)
+        {
+            size_type r_end = ::std::min(br + transpose_block, rows);
+            for (size_type bc = 0; bc < columns; bc += transpose_block)
+            {
+                size_type c_end = ::std::min(bc + transpose_block, columns);
+                for (size_type r = br; r < r_end; r++)
+                    for (size_type c = bc; c < c_end; c++)
+                        result[(c * rows) + r] = pixels[Idx(r, c)];
+            }
+        }
+        ::std::memcpy(pixels, result.data(), size() * sizeof(Pixel));
+        ::std::swap(rows, columns);
+        row_length = columns;
+    }
+    markDirty();
+}
+
+void PixelMatrix::rotate90clockwise() noexcept
+{
+    transpose();
+    flipHorizontal();
+}
+
+void PixelMatrix::rotate90counterclockwise() noexcept
+{
+    transpose();
+    flipVertical();
+}
+
+void PixelMatrix::rotate180() noexcept
+{
+    ::std::reverse(begin(), end());
+    markDirty();
+}
+
+void PixelMatrix::flipVertical() noexcept
+{
+    for (size_type r = 0; r < (rows / 2); r++)
+        ::std::swap_ranges(
+            begin() + Idx(r, 0),
+            begin() + Idx(r, columns),
+            begin() + Idx(rows - 1 - r, 0));
+    markDirty();
+}
+
+void PixelMatrix::flipHorizontal() noexcept
+{
+    for (size_type r = 0; r < rows; r++)
+        ::std::reverse(begin() + Idx(r, 0), begin() + Idx(r, columns));
+    markDirty();
+}
+
+void PixelMatrix::markDirty(const PixelRect &area) noexcept
+{
+    PixelRect rect = clip(area, rows, columns);
+    if (change_tracking && rect.row_count && rect.column_count)
+        addDirtyRange(
+            Idx(rect.row, rect.column),
+            Idx(rect.row + rect.row_count - 1,
+                rect.column + rect.column_count - 1));
+}
+
+bool PixelMatrix::dirtyRow(PixelMatrix::size_type row) const noexcept
+{
+    if (row >= rows)
+        return false;
+    if (!change_tracking)
+        return true;
+    return (row < dirty_rows.size()) && dirty_rows[row];
+}
+
+PixelStatistics PixelMatrix::statistics(const PixelRect &area) const noexcept
+{
+    PixelRect rect = clip(area, rows, columns);
+    StatisticsAccumulator acc;
+    for (size_type row = rect.row; row < (rect.row + rect.row_count); row++)
+        acc.add(data() + Idx(row, rect.column), rect.column_count);
+    return acc.result();
+}
+
+void PixelMatrix::hueHistogram(
+    ::std::size_t *histogram,
+    ::std::size_t bin_count,
+    const PixelRect &area) const noexcept
 {
-    if ((rows > 1) && (columns > 0))
+    if (histogram && bin_count)
     {
-        shift(0, size() - 1, (count * columns));
+        PixelRect rect = clip(area, rows, columns);
+        for (size_type row = rect.row;
+             row < (rect.row + rect.row_count);
+             row++)
+            add_to_histogram(
+                data() + Idx(row, rect.column),
+                rect.column_count,
+                histogram,
+                bin_count);
     }
 }
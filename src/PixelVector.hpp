@@ -14,11 +14,246 @@
 //------------------------------------------------------------------------------
 
 #include <vector>
+#include <cstddef>
+#include <cassert>
+#include <iterator>
 #include <initializer_list>
 #include "Pixel.hpp"
 
 //------------------------------------------------------------------------------
 
+/**
+ * @brief Color statistics of a set of pixels
+ *
+ */
+struct PixelStatistics
+{
+    /// @brief Average color
+    Pixel mean;
+    /// @brief Highest channel value
+    uint8_t max_channel = 0;
+    /// @brief Average luminance in the HSL model
+    uint8_t luminance = 0;
+    /// @brief Number of pixels
+    ::std::size_t count = 0;
+};
+
+/**
+ * @brief Rectangular area in a matrix of pixels
+ *
+ */
+struct PixelRect
+{
+    /// @brief Top row
+    ::std::size_t row = 0;
+    /// @brief Leftmost column
+    ::std::size_t column = 0;
+    /// @brief Number of rows (height)
+    ::std::size_t row_count = 0;
+    /// @brief Number of columns (width)
+    ::std::size_t column_count = 0;
+};
+
+/**
+ * @brief Scroll direction in a matrix of pixels
+ *
+ */
+enum class ScrollDirection
+{
+    /// @brief Rows move to lower row indices
+    up,
+    /// @brief Rows move to higher row indices
+    down,
+    /// @brief Columns move to lower column indices
+    left,
+    /// @brief Columns move to higher column indices
+    right
+};
+
+/**
+ * @brief Resampling filter
+ *
+ */
+enum class ResampleFilter
+{
+    /// @brief Nearest neighbor
+    nearest,
+    /// @brief Linear interpolation of the four nearest pixels
+    bilinear,
+    /// @brief Average of the source pixels covered by each pixel
+    ///        (best for downscaling)
+    box
+};
+
+/**
+ * @brief Mirror symmetry of a pixel matrix
+ *
+ */
+enum class Symmetry
+{
+    /// @brief The left half is mirrored into the right half
+    horizontal,
+    /// @brief The top half is mirrored into the bottom half
+    vertical,
+    /// @brief The top-left quarter is mirrored into the other quarters
+    quadrant,
+    /// @brief The top-left eighth (at or above the diagonal of the
+    ///        top-left quarter) is mirrored into the rest of the matrix.
+    ///        Intended for square matrices.
+    octant
+};
+
+/**
+ * @brief Contiguous sequence of pixels (non-owning)
+ *
+ * @note There are no bound checks, except for assertions
+ *
+ * @tparam T Pixel or const Pixel
+ */
+template <typename T>
+struct BasicPixelSpan
+{
+    /// @brief Pointer to the first pixel
+    T *ptr = nullptr;
+    /// @brief Number of pixels
+    ::std::size_t count = 0;
+
+    /**
+     * @brief Get the number of pixels
+     *
+     * @return ::std::size_t Number of pixels
+     */
+    ::std::size_t size() const noexcept { return count; }
+
+    /**
+     * @brief Get a pointer to the first pixel
+     *
+     * @return T* Pointer to the first pixel
+     */
+    T *data() const noexcept { return ptr; }
+
+    /// @brief Iterator to the first pixel
+    /// @return T* Iterator
+    T *begin() const noexcept { return ptr; }
+
+    /// @brief Iterator past the last pixel
+    /// @return T* Iterator
+    T *end() const noexcept { return ptr + count; }
+
+    /**
+     * @brief Access to a pixel
+     *
+     * @param index Pixel index
+     * @return T& Pixel
+     */
+    T &operator[](::std::size_t index) const noexcept
+    {
+        assert(index < count);
+        return ptr[index];
+    }
+};
+
+/// @brief Contiguous sequence of pixels (non-owning)
+using PixelSpan = BasicPixelSpan<Pixel>;
+/// @brief Contiguous sequence of read-only pixels (non-owning)
+using ConstPixelSpan = BasicPixelSpan<const Pixel>;
+
+/**
+ * @brief Sequence of pixels at a fixed distance from each other
+ *        (non-owning)
+ *
+ * @note There are no bound checks, except for assertions
+ *
+ * @tparam T Pixel or const Pixel
+ */
+template <typename T>
+struct BasicPixelStride
+{
+    /// @brief Pointer to the first pixel
+    T *ptr = nullptr;
+    /// @brief Number of pixels
+    ::std::size_t count = 0;
+    /// @brief Distance between two consecutive pixels
+    ::std::size_t stride = 1;
+
+    /**
+     * @brief Iterator
+     *
+     */
+    struct iterator
+    {
+        using iterator_category = ::std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = ::std::ptrdiff_t;
+        using pointer = T *;
+        using reference = T &;
+
+        /// @brief Current pixel
+        T *ptr;
+        /// @brief Distance between two consecutive pixels
+        ::std::size_t stride;
+
+        T &operator*() const noexcept { return *ptr; }
+        T *operator->() const noexcept { return ptr; }
+        iterator &operator++() noexcept
+        {
+            ptr += stride;
+            return *this;
+        }
+        iterator operator++(int) noexcept
+        {
+            iterator result = *this;
+            ptr += stride;
+            return result;
+        }
+        bool operator==(const iterator &other) const noexcept
+        {
+            return ptr == other.ptr;
+        }
+        bool operator!=(const iterator &other) const noexcept
+        {
+            return ptr != other.ptr;
+        }
+    };
+
+    /**
+     * @brief Get the number of pixels
+     *
+     * @return ::std::size_t Number of pixels
+     */
+    ::std::size_t size() const noexcept { return count; }
+
+    /// @brief Iterator to the first pixel
+    /// @return iterator Iterator
+    iterator begin() const noexcept { return iterator{ptr, stride}; }
+
+    /// @brief Iterator past the last pixel
+    /// @return iterator Iterator
+    iterator end() const noexcept
+    {
+        return iterator{ptr + (count * stride), stride};
+    }
+
+    /**
+     * @brief Access to a pixel
+     *
+     * @param index Pixel index
+     * @return T& Pixel
+     */
+    T &operator[](::std::size_t index) const noexcept
+    {
+        assert(index < count);
+        return ptr[index * stride];
+    }
+};
+
+/// @brief Sequence of pixels at a fixed distance (non-owning)
+using PixelStride = BasicPixelStride<Pixel>;
+/// @brief Sequence of read-only pixels at a fixed distance (non-owning)
+using ConstPixelStride = BasicPixelStride<const Pixel>;
+
+//------------------------------------------------------------------------------
+
 /**
  * @brief Vector of pixels
  *
@@ -63,6 +298,8 @@ public:
     /**
      * @brief Fill the entire vector with a pixel color
      *
+     * @note Pixels are written one machine word at a time
+     *
      * @param color Pixel color
      */
     void fill(const Pixel &color);
@@ -70,14 +307,567 @@ public:
     /**
      * @brief Fill a segment with a pixel color
      *
+     * @note Pixels are written one machine word at a time
+     *
      * @param color Pixel color
      * @param fromIndex Segment start index (inclusive)
      * @param toIndex Segment end index (inclusive)
      */
     void fill(const Pixel &color, size_type fromIndex, size_type toIndex);
 
+    /**
+     * @brief Reduce the brightness of all pixels
+     *
+     * @note Same as Pixel::dim() on every pixel,
+     *       but processing several channels at once
+     *
+     * @param factor A brightness reduction factor.
+     *               255 will not reduce brightness.
+     *               0 will reduce brightness to black.
+     */
+    void scale(uint8_t factor) noexcept;
+
+    /**
+     * @brief Fade all pixels to black
+     *
+     * @note Processes several channels at once
+     *
+     * @param amount Fade amount.
+     *               0 will not reduce brightness.
+     *               255 will reduce brightness to black.
+     */
+    void fadeToBlackBy(uint8_t amount) noexcept { scale(255 - amount); }
+
+    /**
+     * @brief Additive blend with another vector of pixels
+     *
+     * @note Each channel becomes the saturated sum
+     *       of both channels (up to 255).
+     *       Processes several channels at once.
+     *
+     * @note Only the first min(size(),other.size()) pixels are blended
+     *
+     * @param other Pixels to add
+     */
+    void blendAdd(const PixelVector &other) noexcept;
+
+    /**
+     * @brief Maximum blend with another vector of pixels
+     *
+     * @note Each channel becomes the highest of both channels.
+     *       Processes several channels at once.
+     *
+     * @note Only the first min(size(),other.size()) pixels are blended
+     *
+     * @param other Pixels to compare to
+     */
+    void blendMax(const PixelVector &other) noexcept;
+
+    /**
+     * @brief Crossfade between two vectors of pixels
+     *
+     * @note This vector is set to Pixel::blend() of @p from and @p to,
+     *       processing several channels at once.
+     *       Any of them may be this vector.
+     *
+     * @note Only the first min(size(),from.size(),to.size()) pixels
+     *       are written
+     *
+     * @param from Pixels at the start of the transition
+     * @param to Pixels at the end of the transition
+     * @param amount Transition amount.
+     *               0 will copy @p from.
+     *               255 will copy @p to.
+     */
+    void crossfade(
+        const PixelVector &from,
+        const PixelVector &to,
+        uint8_t amount) noexcept;
+
+    /**
+     * @brief Move all pixels towards a target
+     *
+     * @note Same as crossfade(*this, target, step), but channels
+     *       that differ from the target always move at least one unit.
+     *       Calling this method repeatedly will reach the target.
+     *
+     * @note Only the first min(size(),target.size()) pixels are moved
+     *
+     * @param target Target pixels
+     * @param step Step amount.
+     *             0 will not move any pixel.
+     *             255 will copy @p target.
+     */
+    void lerpTowards(const PixelVector &target, uint8_t step) noexcept;
+
+    /**
+     * @brief Copy packed RGB values into this vector
+     *
+     * @note Same packing as Pixel(uint32_t): 0xRRGGBB.
+     *       Processes several pixels at once.
+     *
+     * @note The size of this vector does not change.
+     *       Only the first min(size(),count) pixels are assigned.
+     *
+     * @param packed Packed RGB values
+     * @param count Count of values in @p packed
+     */
+    void assignPacked(const uint32_t *packed, size_type count) noexcept;
+
+    /**
+     * @brief Copy this vector into packed RGB values
+     *
+     * @note Same packing as Pixel(uint32_t): 0xRRGGBB.
+     *       Processes several pixels at once.
+     *
+     * @param packed Destination. Must have room for size() values.
+     */
+    void exportPacked(uint32_t *packed) const noexcept;
+
+    /**
+     * @brief Copy RGBX quadruplets into this vector
+     *
+     * @note Four bytes per pixel in this order: red, green, blue and
+     *       an ignored byte. Processes several pixels at once.
+     *
+     * @note The size of this vector does not change.
+     *       Only the first min(size(),count) pixels are assigned.
+     *
+     * @param rgbx RGBX bytes
+     * @param count Count of pixels in @p rgbx
+     */
+    void assignRGBX(const uint8_t *rgbx, size_type count) noexcept;
+
+    /**
+     * @brief Copy this vector into RGBX quadruplets
+     *
+     * @note Four bytes per pixel in this order: red, green, blue and zero.
+     *       Processes several pixels at once.
+     *
+     * @param rgbx Destination. Must have room for 4*size() bytes.
+     */
+    void exportRGBX(uint8_t *rgbx) const noexcept;
+
+    /**
+     * @brief Box blur
+     *
+     * @note Each pixel becomes the average of the
+     *       2*@p radius+1 pixels around it.
+     *       Pixels beyond both ends are taken as copies of the end pixels.
+     *       The cost per pixel does not depend on @p radius.
+     *
+     * @param radius Blur radius. Zero will not blur.
+     */
+    void boxBlur(size_type radius) noexcept;
+
+    /**
+     * @brief Approximate gaussian blur
+     *
+     * @note Computed as three successive box blurs,
+     *       so the standard deviation is about
+     *       sqrt(@p radius * (@p radius + 1)).
+     *       The cost per pixel does not depend on @p radius.
+     *
+     * @param radius Radius of each box blur. Zero will not blur.
+     */
+    void gaussianBlur(size_type radius) noexcept;
+
+    /**
+     * @brief Fill the entire vector with a color in the HSL model
+     *
+     * @param hue Hue where 65536 units are 360 degrees
+     * @param saturation Saturation in the range [0,255]
+     * @param luminance Luminance in the range [0,255]
+     */
+    void fillHue(
+        uint16_t hue,
+        uint8_t saturation = 255,
+        uint8_t luminance = 127) noexcept;
+
+    /**
+     * @brief Fill the entire vector with rainbow colors
+     *
+     * @note Hue is stepped incrementally in fixed-point arithmetic.
+     *       Saturation and luminance are computed once.
+     *
+     * @param startHue Hue of the first pixel where 65536 units are 360 degrees
+     * @param deltaHue Hue increment from one pixel to the next one
+     * @param saturation Saturation in the range [0,255]
+     * @param luminance Luminance in the range [0,255]
+     */
+    void fillRainbow(
+        uint16_t startHue,
+        uint16_t deltaHue,
+        uint8_t saturation = 255,
+        uint8_t luminance = 127) noexcept;
+
+    /**
+     * @brief Compute color statistics of all pixels in a single pass
+     *
+     * @return PixelStatistics Mean color, maximum channel value
+     *                         and average luminance
+     */
+    PixelStatistics statistics() const noexcept;
+
+    /**
+     * @brief Compute color statistics of a segment in a single pass
+     *
+     * @param fromIndex Segment start index (inclusive)
+     * @param toIndex Segment end index (inclusive)
+     * @return PixelStatistics Mean color, maximum channel value
+     *                         and average luminance
+     */
+    PixelStatistics statistics(
+        size_type fromIndex,
+        size_type toIndex) const noexcept;
+
+    /**
+     * @brief Compute a hue histogram of all pixels
+     *
+     * @note Achromatic pixels (grays) are not counted
+     *
+     * @param histogram Array of @p bin_count counters.
+     *                  Counters are incremented, not reset.
+     * @param bin_count Number of bins. Each bin spans
+     *                  360/bin_count degrees, starting at 0 degrees.
+     */
+    void hueHistogram(
+        ::std::size_t *histogram,
+        ::std::size_t bin_count) const noexcept;
+
+    /**
+     * @brief Compute a hue histogram of a segment
+     *
+     * @note Achromatic pixels (grays) are not counted
+     *
+     * @param histogram Array of @p bin_count counters.
+     *                  Counters are incremented, not reset.
+     * @param bin_count Number of bins. Each bin spans
+     *                  360/bin_count degrees, starting at 0 degrees.
+     * @param fromIndex Segment start index (inclusive)
+     * @param toIndex Segment end index (inclusive)
+     */
+    void hueHistogram(
+        ::std::size_t *histogram,
+        ::std::size_t bin_count,
+        size_type fromIndex,
+        size_type toIndex) const noexcept;
+
+    /**
+     * @brief Access to a pixel
+     *
+     * @note There are bound checks
+     *
+     * @note The pixel is marked as dirty. See trackChanges().
+     *
+     * @param index Pixel index
+     * @return Pixel& Pixel
+     */
+    Pixel &at(size_type index)
+    {
+        Pixel &result = ::std::vector<Pixel>::at(index);
+        markDirty(index, index);
+        return result;
+    }
+
+    using ::std::vector<Pixel>::at;
+
+    /**
+     * @brief Enable or disable change tracking
+     *
+     * @note When enabled, this vector records which pixels were modified
+     *       (dirty pixels) through fill(), at(), shift(),
+     *       scrolls and bulk kernels, so displays can skip unchanged pixels.
+     *       Writes through operator[]() or data() are not tracked:
+     *       call markDirty() afterwards.
+     *
+     * @note Enabling change tracking marks all pixels as dirty
+     *
+     * @note Displays remember the last generation they have shown
+     *       (see generation()), so a vector may be shown in several
+     *       LED strips. Call markClean() once the frame has been shown
+     *       in all of them.
+     *
+     * @param enable True to enable, false to disable
+     */
+    void trackChanges(bool enable) noexcept;
+
+    /**
+     * @brief Check if change tracking is enabled
+     *
+     * @return true If enabled
+     * @return false If disabled
+     */
+    bool tracksChanges() const noexcept { return change_tracking; }
+
+    /**
+     * @brief Get the range of dirty pixels
+     *
+     * @note All pixels are dirty if change tracking is disabled
+     *
+     * @param[out] first First dirty pixel (logical index)
+     * @param[out] last Last dirty pixel (logical index)
+     * @return true If there are dirty pixels
+     * @return false If no pixel was modified since the last markClean()
+     */
+    bool dirtyRange(size_type &first, size_type &last) const noexcept;
+
+    /**
+     * @brief Get the generation of the last change
+     *
+     * @note Every recorded change (see markDirty()) gets a new generation,
+     *       unique among all pixel vectors
+     *
+     * @return uint32_t Generation of the last change
+     */
+    uint32_t generation() const noexcept { return change_generation; }
+
+    /**
+     * @brief Get the range of pixels modified after a given generation
+     *
+     * @note All pixels are dirty if change tracking is disabled or
+     *       @p since is older than the last markClean()
+     *
+     * @param since A generation previously returned by generation()
+     * @param[out] first First dirty pixel (logical index)
+     * @param[out] last Last dirty pixel (logical index)
+     * @return true If there are dirty pixels
+     * @return false If no pixel was modified after @p since
+     */
+    bool dirtyRange(
+        uint32_t since,
+        size_type &first,
+        size_type &last) const noexcept;
+
+    /**
+     * @brief Mark all pixels as dirty
+     *
+     * @note Does nothing if change tracking is disabled
+     */
+    void markDirty() noexcept
+    {
+        if (size())
+            markDirty(0, size() - 1);
+    }
+
+    /**
+     * @brief Mark a segment as dirty
+     *
+     * @note Does nothing if change tracking is disabled
+     *
+     * @param first Segment start index (inclusive)
+     * @param last Segment end index (inclusive)
+     */
+    void markDirty(size_type first, size_type last) noexcept
+    {
+        if (change_tracking)
+            addDirtyRange(first, last);
+    }
+
+    /**
+     * @brief Mark all pixels as not dirty
+     *
+     * @note Call once all displays have shown this vector.
+     *       Displays showing it later transmit all pixels.
+     */
+    void markClean() noexcept;
+
     // Do not hide constructors
     using ::std::vector<Pixel>::vector;
+
+    /// @brief Create an empty vector
+    PixelVector() noexcept = default;
+
+    /**
+     * @brief Copy-constructor
+     *
+     * @note Change tracking is enabled if enabled in @p source.
+     *       All pixels are dirty.
+     *
+     * @param source Instance to be copied
+     */
+    PixelVector(const PixelVector &source);
+
+    /**
+     * @brief Move-constructor
+     *
+     * @note Change tracking is enabled if enabled in @p source.
+     *       All pixels are dirty.
+     *
+     * @param source Instance transferring ownership
+     */
+    PixelVector(PixelVector &&source) noexcept;
+
+    /**
+     * @brief Copy-assignment
+     *
+     * @note Change tracking is not copied.
+     *       All pixels are marked as dirty, so displays
+     *       do not rely on the dirty state of @p source.
+     *
+     * @param source Instance to be copied
+     * @return PixelVector& This instance
+     */
+    PixelVector &operator=(const PixelVector &source);
+
+    /**
+     * @brief Move-assignment
+     *
+     * @note Change tracking is not moved.
+     *       All pixels are marked as dirty.
+     *
+     * @param source Instance transferring ownership
+     * @return PixelVector& This instance
+     */
+    PixelVector &operator=(PixelVector &&source) noexcept;
+
+    /**
+     * @brief Exchange pixels with another vector
+     *
+     * @note Change tracking is not exchanged.
+     *       All pixels in both vectors are marked as dirty.
+     *
+     * @param other Other vector
+     */
+    void swap(PixelVector &other) noexcept;
+
+    /**
+     * @brief Change the count of pixels
+     *
+     * @note All pixels are marked as dirty
+     *
+     * @param count New count of pixels
+     * @param color Color of new pixels
+     */
+    void resize(size_type count, const Pixel &color = Pixel());
+
+    /**
+     * @brief Remove all pixels
+     *
+     */
+    void clear() noexcept
+    {
+        ::std::vector<Pixel>::clear();
+        markDirty();
+    }
+
+    /**
+     * @brief Replace all pixels
+     *
+     * @note Same parameters as ::std::vector::assign().
+     *       All pixels are marked as dirty.
+     *
+     * @tparam Args Argument types
+     * @param args Arguments
+     */
+    template <typename... Args>
+    void assign(Args &&...args)
+    {
+        ::std::vector<Pixel>::assign(::std::forward<Args>(args)...);
+        markDirty();
+    }
+
+    /**
+     * @brief Replace all pixels
+     *
+     * @note All pixels are marked as dirty
+     *
+     * @param list New pixels
+     */
+    void assign(::std::initializer_list<Pixel> list)
+    {
+        ::std::vector<Pixel>::assign(list);
+        markDirty();
+    }
+
+    /**
+     * @brief Insert pixels
+     *
+     * @note Same parameters as ::std::vector::insert().
+     *       All pixels are marked as dirty.
+     *
+     * @tparam Args Argument types
+     * @param args Arguments
+     * @return iterator Position of the first inserted pixel
+     */
+    template <typename... Args>
+    iterator insert(Args &&...args)
+    {
+        iterator result =
+            ::std::vector<Pixel>::insert(::std::forward<Args>(args)...);
+        markDirty();
+        return result;
+    }
+
+    /**
+     * @brief Remove pixels
+     *
+     * @note Same parameters as ::std::vector::erase().
+     *       All pixels are marked as dirty.
+     *
+     * @tparam Args Argument types
+     * @param args Arguments
+     * @return iterator Position following the removed pixels
+     */
+    template <typename... Args>
+    iterator erase(Args &&...args)
+    {
+        iterator result =
+            ::std::vector<Pixel>::erase(::std::forward<Args>(args)...);
+        markDirty();
+        return result;
+    }
+
+    /**
+     * @brief Append a pixel
+     *
+     * @note The new pixel is marked as dirty
+     *
+     * @param pixel Pixel to append
+     */
+    void push_back(const Pixel &pixel)
+    {
+        ::std::vector<Pixel>::push_back(pixel);
+        markDirty(size() - 1, size() - 1);
+    }
+
+    /**
+     * @brief Remove the last pixel
+     *
+     * @note All pixels are marked as dirty
+     */
+    void pop_back() noexcept
+    {
+        ::std::vector<Pixel>::pop_back();
+        markDirty();
+    }
+
+protected:
+    /// @brief Row length in a matrix of pixels, zero otherwise
+    size_type row_length = 0;
+    /// @brief Change tracking is enabled
+    bool change_tracking = false;
+    /// @brief First dirty pixel (logical index)
+    size_type dirty_first = 1;
+    /// @brief Last dirty pixel (logical index).
+    /// @note Nothing is dirty if less than @p dirty_first
+    size_type dirty_last = 0;
+    /// @brief Dirty rows (matrices only)
+    ::std::vector<bool> dirty_rows;
+    /// @brief Generation of the last change
+    uint32_t change_generation = 0;
+    /// @brief Generation of the last change when markClean() was called
+    uint32_t clean_generation = 0;
+
+    /**
+     * @brief Record a modified range of pixels
+     *
+     * @note Change tracking must be enabled
+     *
+     * @param first First modified pixel (logical index)
+     * @param last Last modified pixel (logical index)
+     */
+    void addDirtyRange(size_type first, size_type last) noexcept;
 }; // PixelVector
 
 //------------------------------------------------------------------------------
@@ -159,6 +949,142 @@ struct PixelMatrix : public PixelVector
      */
     const Pixel &at(size_type row, size_type col) const;
 
+    /**
+     * @brief Access to a pixel
+     *
+     * @note There are no bound checks, except for assertions.
+     *       Not tracked (see PixelVector::trackChanges()).
+     *
+     * @param row Row index
+     * @param col Column index
+     * @return Pixel& Pixel
+     */
+    Pixel &operator()(size_type row, size_type col) noexcept
+    {
+        assert((row < rows) && (col < columns));
+        return data()[(row * columns) + col];
+    }
+
+    /**
+     * @brief Access to a pixel
+     *
+     * @note There are no bound checks, except for assertions
+     *
+     * @param row Row index
+     * @param col Column index
+     * @return const Pixel& Pixel
+     */
+    const Pixel &operator()(size_type row, size_type col) const noexcept
+    {
+        assert((row < rows) && (col < columns));
+        return data()[(row * columns) + col];
+    }
+
+    /**
+     * @brief Get a row of pixels
+     *
+     * @note There are no bound checks, except for assertions.
+     *       The row is marked as dirty (see PixelVector::trackChanges()).
+     *
+     * @param row Row index
+     * @return PixelSpan Contiguous pixels in the row.
+     *                   Invalidated when the matrix is resized.
+     */
+    PixelSpan row(size_type row) noexcept
+    {
+        assert(row < rows);
+        markDirty(row * columns, (row * columns) + columns - 1);
+        return PixelSpan{data() + (row * columns), columns};
+    }
+
+    /**
+     * @brief Get a row of pixels
+     *
+     * @note There are no bound checks, except for assertions
+     *
+     * @param row Row index
+     * @return ConstPixelSpan Contiguous pixels in the row.
+     *                        Invalidated when the matrix is resized.
+     */
+    ConstPixelSpan row(size_type row) const noexcept
+    {
+        assert(row < rows);
+        return ConstPixelSpan{data() + (row * columns), columns};
+    }
+
+    /**
+     * @brief Get a column of pixels
+     *
+     * @note There are no bound checks, except for assertions.
+     *       All rows are marked as dirty
+     *       (see PixelVector::trackChanges()).
+     *
+     * @param col Column index
+     * @return PixelStride Pixels in the column.
+     *                     Invalidated when the matrix is resized.
+     */
+    PixelStride column(size_type col) noexcept
+    {
+        assert(col < columns);
+        markDirty();
+        return PixelStride{data() + col, rows, columns};
+    }
+
+    /**
+     * @brief Get a column of pixels
+     *
+     * @note There are no bound checks, except for assertions
+     *
+     * @param col Column index
+     * @return ConstPixelStride Pixels in the column.
+     *                          Invalidated when the matrix is resized.
+     */
+    ConstPixelStride column(size_type col) const noexcept
+    {
+        assert(col < columns);
+        return ConstPixelStride{data() + col, rows, columns};
+    }
+
+    /**
+     * @brief Call a function for every pixel in row-major order
+     *
+     * @note Rows are traversed as contiguous arrays,
+     *       so simple functions can be vectorized by the compiler.
+     *       All pixels are marked as dirty.
+     *
+     * @tparam Function Callable type: void(size_type row,
+     *                  size_type col, Pixel &pixel)
+     * @param function Function to call
+     */
+    template <typename Function>
+    void forEach(Function function)
+    {
+        markDirty();
+        Pixel *pixel = data();
+        for (size_type r = 0; r < rows; r++, pixel += columns)
+            for (size_type c = 0; c < columns; c++)
+                function(r, c, pixel[c]);
+    }
+
+    /**
+     * @brief Call a function for every pixel in row-major order
+     *
+     * @note Rows are traversed as contiguous arrays,
+     *       so simple functions can be vectorized by the compiler.
+     *
+     * @tparam Function Callable type: void(size_type row,
+     *                  size_type col, const Pixel &pixel)
+     * @param function Function to call
+     */
+    template <typename Function>
+    void forEach(Function function) const
+    {
+        const Pixel *pixel = data();
+        for (size_type r = 0; r < rows; r++, pixel += columns)
+            for (size_type c = 0; c < columns; c++)
+                function(r, c, pixel[c]);
+    }
+
     /**
      * @brief Copy-constructor
      *
@@ -177,18 +1103,24 @@ struct PixelMatrix : public PixelVector
     /**
      * @brief Copy-assignment
      *
+     * @note All pixels are marked as dirty
+     *       (see PixelVector::operator=())
+     *
      * @param source Instance to be copied
      * @return PixelMatrix& This instance
      */
-    PixelMatrix &operator=(const PixelMatrix &source) noexcept = default;
+    PixelMatrix &operator=(const PixelMatrix &source) noexcept;
 
     /**
      * @brief Move-assignment
      *
+     * @note All pixels are marked as dirty
+     *       (see PixelVector::operator=())
+     *
      * @param source Instance transferring ownership
      * @return PixelMatrix& This instance
      */
-    PixelMatrix &operator=(PixelMatrix &&source) noexcept = default;
+    PixelMatrix &operator=(PixelMatrix &&source) noexcept;
 
     /**
      * @brief Assign an initializer list
@@ -221,6 +1153,31 @@ struct PixelMatrix : public PixelVector
      */
     void fill(const Pixel &color) noexcept;
 
+    /**
+     * @brief Separable box blur
+     *
+     * @note Each pixel becomes the average of the
+     *       (2*@p radius+1)x(2*@p radius+1) pixels around it.
+     *       Pixels beyond the borders are taken as copies of the
+     *       border pixels.
+     *       The cost per pixel does not depend on @p radius.
+     *
+     * @param radius Blur radius. Zero will not blur.
+     */
+    void boxBlur(size_type radius) noexcept;
+
+    /**
+     * @brief Separable approximate gaussian blur
+     *
+     * @note Computed as three successive box blurs,
+     *       so the standard deviation is about
+     *       sqrt(@p radius * (@p radius + 1)).
+     *       The cost per pixel does not depend on @p radius.
+     *
+     * @param radius Radius of each box blur. Zero will not blur.
+     */
+    void gaussianBlur(size_type radius) noexcept;
+
     /**
      * @brief Scroll left
      *
@@ -249,7 +1206,340 @@ struct PixelMatrix : public PixelVector
      */
     void scroll_down(size_type count) noexcept;
 
+    /**
+     * @brief Get a rectangular area covering the whole matrix
+     *
+     * @return PixelRect Bounds of this matrix
+     */
+    PixelRect bounds() const noexcept
+    {
+        return PixelRect{0, 0, rows, columns};
+    }
+
+    /**
+     * @brief Scroll a rectangular area, wrapping around
+     *
+     * @note Pixels leaving the area at one edge come back at the other edge.
+     *       Whole rows (or row segments) are moved at once.
+     *       The area is clipped to the matrix bounds.
+     *
+     * @param direction Scroll direction
+     * @param count Scroll count
+     * @param area Rectangular area. Pixels outside are not modified.
+     */
+    void scroll(
+        ScrollDirection direction,
+        size_type count,
+        const PixelRect &area) noexcept;
+
+    /**
+     * @brief Scroll a rectangular area, filling with a color
+     *
+     * @note Pixels leaving the area are lost.
+     *       Pixels coming in take the given color.
+     *       Whole rows (or row segments) are moved at once.
+     *       The area is clipped to the matrix bounds.
+     *
+     * @param direction Scroll direction
+     * @param count Scroll count
+     * @param area Rectangular area. Pixels outside are not modified.
+     * @param color Color of incoming pixels
+     */
+    void scroll(
+        ScrollDirection direction,
+        size_type count,
+        const PixelRect &area,
+        const Pixel &color) noexcept;
+
+    /**
+     * @brief Scroll a rectangular area, feeding from another matrix
+     *
+     * @note Pixels leaving the area are lost.
+     *       Incoming pixels form a rectangle of @p count rows
+     *       (up or down) or @p count columns (left or right).
+     *       They are copied from the rectangle of the same size
+     *       whose top-left corner is at @p source_row and
+     *       @p source_column in @p source. Pixels outside @p source
+     *       are black. Whole rows (or row segments) are moved at once.
+     *       The area is clipped to the matrix bounds.
+     *
+     * @param direction Scroll direction
+     * @param count Scroll count
+     * @param area Rectangular area. Pixels outside are not modified.
+     * @param source Matrix holding incoming pixels
+     * @param source_row Top row of incoming pixels in @p source
+     * @param source_column Leftmost column of incoming pixels in @p source
+     */
+    void scroll(
+        ScrollDirection direction,
+        size_type count,
+        const PixelRect &area,
+        const PixelMatrix &source,
+        size_type source_row,
+        size_type source_column) noexcept;
+
+    /**
+     * @brief Copy a rectangular area from another matrix
+     *
+     * @note The area is clipped to the bounds of both matrices.
+     *       Rows are copied as blocks.
+     *
+     * @param source Matrix to copy from. May be this matrix.
+     * @param area Area to copy from @p source
+     * @param row Destination row of the top-left pixel in @p area.
+     *            May be negative.
+     * @param column Destination column of the top-left pixel in @p area.
+     *               May be negative.
+     */
+    void blit(
+        const PixelMatrix &source,
+        const PixelRect &area,
+        ::std::ptrdiff_t row,
+        ::std::ptrdiff_t column) noexcept;
+
+    /**
+     * @brief Copy a rectangular area from another matrix
+     *        using a transparent color
+     *
+     * @note The area is clipped to the bounds of both matrices.
+     *       Runs of opaque pixels are copied as blocks.
+     *
+     * @param source Matrix to copy from. May be this matrix.
+     * @param area Area to copy from @p source
+     * @param row Destination row of the top-left pixel in @p area.
+     *            May be negative.
+     * @param column Destination column of the top-left pixel in @p area.
+     *               May be negative.
+     * @param color_key Pixels of this color in @p source are not copied
+     */
+    void blit(
+        const PixelMatrix &source,
+        const PixelRect &area,
+        ::std::ptrdiff_t row,
+        ::std::ptrdiff_t column,
+        const Pixel &color_key) noexcept;
+
+    /**
+     * @brief Copy a rectangular area from another matrix
+     *        using a transparency mask
+     *
+     * @note The area is clipped to the bounds of both matrices.
+     *       Runs of opaque pixels are copied as blocks.
+     *
+     * @param source Matrix to copy from. May be this matrix.
+     * @param area Area to copy from @p source
+     * @param row Destination row of the top-left pixel in @p area.
+     *            May be negative.
+     * @param column Destination column of the top-left pixel in @p area.
+     *               May be negative.
+     * @param mask One boolean per pixel in @p source (row-major order).
+     *             Pixels are copied where @p mask is true.
+     *             Missing booleans are taken as false.
+     */
+    void blit(
+        const PixelMatrix &source,
+        const PixelRect &area,
+        ::std::ptrdiff_t row,
+        ::std::ptrdiff_t column,
+        const ::std::vector<bool> &mask) noexcept;
+
+    /**
+     * @brief Resample another matrix into this one
+     *
+     * @note The size of this matrix is not changed, so it may be
+     *       created by LEDStrip::pixelMatrix().
+     *       Fixed-point arithmetic. No floating point is used.
+     *
+     * @param source Matrix to resample. May be this matrix.
+     * @param filter Resampling filter
+     */
+    void resample(
+        const PixelMatrix &source,
+        ResampleFilter filter = ResampleFilter::bilinear) noexcept;
+
+    /**
+     * @brief Get a resampled copy of this matrix
+     *
+     * @param rows Row count of the copy
+     * @param columns Column count of the copy
+     * @param filter Resampling filter
+     * @return PixelMatrix Resampled copy
+     */
+    PixelMatrix resampled(
+        size_type rows,
+        size_type columns,
+        ResampleFilter filter = ResampleFilter::bilinear) const noexcept
+    {
+        PixelMatrix result(rows, columns);
+        result.resample(*this, filter);
+        return result;
+    }
+
+    /**
+     * @brief Get the area to render before mirroring
+     *
+     * @note For Symmetry::octant, only the pixels at or above the
+     *       diagonal of this area (column >= row) are required.
+     *
+     * @param symmetry Mirror symmetry
+     * @return PixelRect Area to render
+     */
+    PixelRect mirrorArea(Symmetry symmetry) const noexcept;
+
+    /**
+     * @brief Mirror a rendered area into the rest of this matrix
+     *
+     * @note Render the area given by mirrorArea() first,
+     *       so symmetric effects compute a fraction of the pixels.
+     *       Rows are copied as blocks (or reversed blocks).
+     *
+     * @param symmetry Mirror symmetry
+     */
+    void mirror(Symmetry symmetry) noexcept;
+
+    /**
+     * @brief Swap rows and columns
+     *
+     * @note Square matrices are transposed in place.
+     *       Otherwise, a temporary copy is required.
+     *       Pixels are moved in small square blocks,
+     *       so both rows and columns are cache-friendly.
+     *       All pixels are marked as dirty.
+     */
+    void transpose() noexcept;
+
+    /**
+     * @brief Rotate the contents 90 degrees clockwise
+     *
+     * @note Rows and columns are swapped. In place if square.
+     *       Matches LedMatrixParameters::rotate90clockwise().
+     */
+    void rotate90clockwise() noexcept;
+
+    /**
+     * @brief Rotate the contents 90 degrees counterclockwise
+     *
+     * @note Rows and columns are swapped. In place if square.
+     */
+    void rotate90counterclockwise() noexcept;
+
+    /**
+     * @brief Rotate the contents 180 degrees (in place)
+     *
+     */
+    void rotate180() noexcept;
+
+    /**
+     * @brief Reverse the contents along the horizontal axis (in place)
+     *
+     * @note Matches LedMatrixParameters::flipVertical()
+     */
+    void flipVertical() noexcept;
+
+    /**
+     * @brief Reverse the contents along the vertical axis (in place)
+     *
+     * @note Matches LedMatrixParameters::flipHorizontal()
+     */
+    void flipHorizontal() noexcept;
+
+    using PixelVector::markDirty;
+
+    /**
+     * @brief Mark a rectangular area as dirty
+     *
+     * @note Does nothing if change tracking is disabled.
+     *       See PixelVector::trackChanges().
+     *
+     * @param area Rectangular area
+     */
+    void markDirty(const PixelRect &area) noexcept;
+
+    /**
+     * @brief Check if a row contains dirty pixels
+     *
+     * @note All rows are dirty if change tracking is disabled
+     *
+     * @param row Row index
+     * @return true If the row contains dirty pixels
+     * @return false Otherwise
+     */
+    bool dirtyRow(size_type row) const noexcept;
+
+    using PixelVector::statistics;
+
+    /**
+     * @brief Compute color statistics of a rectangular area
+     *        in a single pass
+     *
+     * @note The area is clipped to the matrix bounds
+     *
+     * @param area Rectangular area
+     * @return PixelStatistics Mean color, maximum channel value
+     *                         and average luminance
+     */
+    PixelStatistics statistics(const PixelRect &area) const noexcept;
+
+    using PixelVector::hueHistogram;
+
+    /**
+     * @brief Compute a hue histogram of a rectangular area
+     *
+     * @note Achromatic pixels (grays) are not counted.
+     *       The area is clipped to the matrix bounds.
+     *
+     * @param histogram Array of @p bin_count counters.
+     *                  Counters are incremented, not reset.
+     * @param bin_count Number of bins. Each bin spans
+     *                  360/bin_count degrees, starting at 0 degrees.
+     * @param area Rectangular area
+     */
+    void hueHistogram(
+        ::std::size_t *histogram,
+        ::std::size_t bin_count,
+        const PixelRect &area) const noexcept;
+
 private:
+    /**
+     * @brief Copy a rectangular area from another matrix (any mode)
+     *
+     * @param source Matrix to copy from
+     * @param area Area to copy from @p source
+     * @param row Destination row of the top-left pixel in @p area
+     * @param column Destination column of the top-left pixel in @p area
+     * @param color_key Transparent color or nullptr
+     * @param mask Transparency mask or nullptr.
+     *             Opaque mode if both @p color_key and @p mask are null.
+     */
+    void blitArea(
+        const PixelMatrix &source,
+        const PixelRect &area,
+        ::std::ptrdiff_t row,
+        ::std::ptrdiff_t column,
+        const Pixel *color_key,
+        const ::std::vector<bool> *mask) noexcept;
+
+    /**
+     * @brief Scroll a rectangular area (any mode)
+     *
+     * @param direction Scroll direction
+     * @param count Scroll count
+     * @param area Rectangular area
+     * @param color Color of incoming pixels (fill mode) or nullptr
+     * @param source Matrix holding incoming pixels (feed mode) or nullptr.
+     *               Wrap mode if both @p color and @p source are null.
+     * @param source_row Top row of incoming pixels in @p source
+     * @param source_column Leftmost column of incoming pixels in @p source
+     */
+    void scrollArea(
+        ScrollDirection direction,
+        size_type count,
+        const PixelRect &area,
+        const Pixel *color,
+        const PixelMatrix *source,
+        size_type source_row,
+        size_type source_column) noexcept;
+
     /// @brief Number of rows
     size_type rows;
     /// @brief Number of columns
@@ -0,0 +1,84 @@
+/**
+ * @file PixelViewport.cpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Window into a large pixel matrix
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 License
+ */
+
+#include "PixelViewport.hpp"
+
+//------------------------------------------------------------------------------
+// Viewport
+//------------------------------------------------------------------------------
+
+PixelViewport::PixelViewport(
+    const PixelMatrix &canvas,
+    ::std::size_t row_count,
+    ::std::size_t column_count,
+    ViewportEdge edge)
+    : source{&canvas},
+      edge_behavior{edge},
+      canvas_rows(row_count),
+      canvas_columns(column_count)
+{
+    moveTo(0, 0);
+}
+
+void PixelViewport::canvas(const PixelMatrix &canvas)
+{
+    source = &canvas;
+    moveTo(top, left);
+}
+
+void PixelViewport::moveTo(::std::ptrdiff_t row, ::std::ptrdiff_t column)
+{
+    assert(source->row_count() && source->column_count());
+    top = row;
+    left = column;
+    mapAxis(canvas_rows, row, source->row_count());
+    mapAxis(canvas_columns, column, source->column_count());
+}
+
+void PixelViewport::mapAxis(
+    ::std::vector<::std::size_t> &positions,
+    ::std::ptrdiff_t first,
+    ::std::size_t count) const noexcept
+{
+    ::std::ptrdiff_t size = count;
+    if (edge_behavior == ViewportEdge::wrap)
+    {
+        // Note: a single modulo, then increments
+        ::std::ptrdiff_t position = first % size;
+        if (position < 0)
+            position += size;
+        for (::std::size_t &entry : positions)
+        {
+            entry = position;
+            if (++position == size)
+                position = 0;
+        }
+    }
+    else
+    {
+        ::std::ptrdiff_t position = first;
+        for (::std::size_t &entry : positions)
+        {
+            entry = (position < 0)
+                        ? 0
+                        : ((position >= size) ? (size - 1) : position);
+            position++;
+        }
+    }
+}
+
+void PixelViewport::copyTo(PixelMatrix &destination) const
+{
+    destination.resize(row_count(), column_count());
+    for (::std::size_t r = 0; r < row_count(); r++)
+        for (::std::size_t c = 0; c < column_count(); c++)
+            destination(r, c) = (*this)(r, c);
+}
@@ -0,0 +1,217 @@
+/**
+ * @file PixelViewport.hpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Window into a large pixel matrix
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 License
+ */
+
+#pragma once
+
+//------------------------------------------------------------------------------
+
+#include <vector>
+#include <cstddef>
+#include <cassert>
+#include "PixelVector.hpp"
+
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Behavior of a viewport beyond the edges of its canvas
+ *
+ */
+enum class ViewportEdge : unsigned char
+{
+    /// @brief The canvas repeats itself (wrap around)
+    wrap,
+    /// @brief Pixels at the edges of the canvas repeat themselves
+    clamp
+};
+
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Window into a large pixel matrix (the canvas)
+ *
+ * @note No pixels are copied. The canvas row and column
+ *       of each viewport row and column are precomputed,
+ *       so panning costs O(rows + columns), not O(rows * columns).
+ *
+ * @note The canvas must outlive this viewport.
+ *       Call moveTo() again if the canvas is resized.
+ *
+ * @note Show it in an LED matrix of the same size
+ *       (see LEDStrip::show()).
+ */
+class PixelViewport
+{
+public:
+    /**
+     * @brief Create a viewport at the top-left corner of a canvas
+     *
+     * @param canvas Pixel matrix to look into. Must not be empty.
+     * @param row_count Number of rows in the viewport
+     * @param column_count Number of columns in the viewport
+     * @param edge Behavior beyond the edges of the canvas
+     */
+    PixelViewport(
+        const PixelMatrix &canvas,
+        ::std::size_t row_count,
+        ::std::size_t column_count,
+        ViewportEdge edge = ViewportEdge::wrap);
+
+    /**
+     * @brief Look into another canvas
+     *
+     * @note The viewport does not move
+     *
+     * @param canvas Pixel matrix to look into. Must not be empty.
+     */
+    void canvas(const PixelMatrix &canvas);
+
+    /**
+     * @brief Get the canvas
+     *
+     * @return const PixelMatrix& Canvas
+     */
+    const PixelMatrix &canvas() const noexcept { return *source; }
+
+    /**
+     * @brief Get the behavior beyond the edges of the canvas
+     *
+     * @return ViewportEdge Wrap or clamp
+     */
+    ViewportEdge edge() const noexcept { return edge_behavior; }
+
+    /**
+     * @brief Move the viewport
+     *
+     * @param row Canvas row of the top-left pixel. May be negative
+     *            or out of the canvas.
+     * @param column Canvas column of the top-left pixel. May be negative
+     *               or out of the canvas.
+     */
+    void moveTo(::std::ptrdiff_t row, ::std::ptrdiff_t column);
+
+    /**
+     * @brief Move the viewport relative to its current position
+     *
+     * @param rows Rows to move down (negative to move up)
+     * @param columns Columns to move right (negative to move left)
+     */
+    void pan(::std::ptrdiff_t rows, ::std::ptrdiff_t columns)
+    {
+        moveTo(top + rows, left + columns);
+    }
+
+    /**
+     * @brief Get the canvas row of the top-left pixel
+     *
+     * @return ::std::ptrdiff_t Row, as given to moveTo()
+     */
+    ::std::ptrdiff_t row() const noexcept { return top; }
+
+    /**
+     * @brief Get the canvas column of the top-left pixel
+     *
+     * @return ::std::ptrdiff_t Column, as given to moveTo()
+     */
+    ::std::ptrdiff_t column() const noexcept { return left; }
+
+    /**
+     * @brief Get the number of rows in the viewport
+     *
+     * @return ::std::size_t Number of rows
+     */
+    ::std::size_t row_count() const noexcept { return canvas_rows.size(); }
+
+    /**
+     * @brief Get the number of columns in the viewport
+     *
+     * @return ::std::size_t Number of columns
+     */
+    ::std::size_t column_count() const noexcept
+    {
+        return canvas_columns.size();
+    }
+
+    /**
+     * @brief Get the number of pixels in the viewport
+     *
+     * @return ::std::size_t Number of pixels
+     */
+    ::std::size_t size() const noexcept
+    {
+        return canvas_rows.size() * canvas_columns.size();
+    }
+
+    /**
+     * @brief Access to a pixel
+     *
+     * @note There are no bound checks, except for assertions
+     *
+     * @param row Viewport row
+     * @param col Viewport column
+     * @return const Pixel& Canvas pixel
+     */
+    const Pixel &operator()(
+        ::std::size_t row,
+        ::std::size_t col) const noexcept
+    {
+        assert((row < canvas_rows.size()) && (col < canvas_columns.size()));
+        return (*source)(canvas_rows[row], canvas_columns[col]);
+    }
+
+    /**
+     * @brief Access to a pixel
+     *
+     * @param index Canonical index in the viewport
+     *              (row * column_count() + column)
+     * @return const Pixel& Canvas pixel
+     */
+    const Pixel &operator[](::std::size_t index) const noexcept
+    {
+        return (*this)(
+            index / canvas_columns.size(),
+            index % canvas_columns.size());
+    }
+
+    /**
+     * @brief Copy the pixels in the viewport into a matrix
+     *
+     * @note Not required to show the viewport
+     *
+     * @param[out] destination Pixel matrix. Resized to this viewport.
+     */
+    void copyTo(PixelMatrix &destination) const;
+
+private:
+    /// @brief Canvas
+    const PixelMatrix *source;
+    /// @brief Behavior beyond the edges of the canvas
+    ViewportEdge edge_behavior;
+    /// @brief Canvas row of the top-left pixel
+    ::std::ptrdiff_t top = 0;
+    /// @brief Canvas column of the top-left pixel
+    ::std::ptrdiff_t left = 0;
+    /// @brief Canvas row shown at each viewport row
+    ::std::vector<::std::size_t> canvas_rows;
+    /// @brief Canvas column shown at each viewport column
+    ::std::vector<::std::size_t> canvas_columns;
+
+    /**
+     * @brief Map viewport positions to canvas positions along one axis
+     *
+     * @param[out] positions Canvas position at each viewport position
+     * @param first Canvas position of the first viewport position
+     * @param count Count of canvas positions
+     */
+    void mapAxis(
+        ::std::vector<::std::size_t> &positions,
+        ::std::ptrdiff_t first,
+        ::std::size_t count) const noexcept;
+};
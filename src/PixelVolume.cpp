@@ -0,0 +1,106 @@
+/**
+ * @file PixelVolume.cpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Three-dimensional arrays of pixels
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 License
+ */
+
+#include "PixelVolume.hpp"
+
+//------------------------------------------------------------------------------
+// Construction
+//------------------------------------------------------------------------------
+
+PixelVolume::PixelVolume(
+    size_type layers,
+    size_type rows,
+    size_type columns,
+    Pixel color) noexcept
+    : PixelVector(layers * rows * columns, color),
+      layers{layers},
+      rows{rows},
+      columns{columns}
+{
+}
+
+void PixelVolume::resize(
+    size_type layers,
+    size_type rows,
+    size_type columns,
+    Pixel color) noexcept
+{
+    PixelVector::resize(layers * rows * columns, color);
+    this->layers = layers;
+    this->rows = rows;
+    this->columns = columns;
+    markDirty();
+}
+
+//------------------------------------------------------------------------------
+// Slices
+//------------------------------------------------------------------------------
+
+PixelSlice PixelVolume::sliceZ(size_type z) noexcept
+{
+    assert(z < layers);
+    size_type layer_size = rows * columns;
+    markDirty(z * layer_size, (z * layer_size) + layer_size - 1);
+    return PixelSlice{data() + (z * layer_size), rows, columns, columns, 1};
+}
+
+PixelSlice PixelVolume::sliceY(size_type y) noexcept
+{
+    assert(y < rows);
+    markDirty();
+    return PixelSlice{
+        data() + (y * columns),
+        layers,
+        columns,
+        rows * columns,
+        1};
+}
+
+PixelSlice PixelVolume::sliceX(size_type x) noexcept
+{
+    assert(x < columns);
+    markDirty();
+    return PixelSlice{data() + x, layers, rows, rows * columns, columns};
+}
+
+ConstPixelSlice PixelVolume::sliceZ(size_type z) const noexcept
+{
+    assert(z < layers);
+    size_type layer_size = rows * columns;
+    return ConstPixelSlice{
+        data() + (z * layer_size),
+        rows,
+        columns,
+        columns,
+        1};
+}
+
+ConstPixelSlice PixelVolume::sliceY(size_type y) const noexcept
+{
+    assert(y < rows);
+    return ConstPixelSlice{
+        data() + (y * columns),
+        layers,
+        columns,
+        rows * columns,
+        1};
+}
+
+ConstPixelSlice PixelVolume::sliceX(size_type x) const noexcept
+{
+    assert(x < columns);
+    return ConstPixelSlice{
+        data() + x,
+        layers,
+        rows,
+        rows * columns,
+        columns};
+}
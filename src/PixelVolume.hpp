@@ -0,0 +1,305 @@
+/**
+ * @file PixelVolume.hpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Three-dimensional arrays of pixels
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 License
+ */
+
+#pragma once
+
+//------------------------------------------------------------------------------
+
+#include <cstddef>
+#include <cassert>
+#include <algorithm> // For ::std::min()
+#include "PixelVector.hpp"
+#include "CubeLayout.hpp"
+
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Plane of pixels inside a pixel volume (non-owning)
+ *
+ * @note There are no bound checks, except for assertions
+ *
+ * @tparam T Pixel or const Pixel
+ */
+template <typename T>
+struct BasicPixelSlice
+{
+    /// @brief Pointer to the pixel at row 0 and column 0
+    T *ptr = nullptr;
+    /// @brief Number of rows
+    ::std::size_t rows = 0;
+    /// @brief Number of columns
+    ::std::size_t columns = 0;
+    /// @brief Distance between two consecutive rows
+    ::std::size_t row_stride = 0;
+    /// @brief Distance between two consecutive columns
+    ::std::size_t column_stride = 1;
+
+    /**
+     * @brief Get the number of rows
+     *
+     * @return ::std::size_t Number of rows
+     */
+    ::std::size_t row_count() const noexcept { return rows; }
+
+    /**
+     * @brief Get the number of columns
+     *
+     * @return ::std::size_t Number of columns
+     */
+    ::std::size_t column_count() const noexcept { return columns; }
+
+    /**
+     * @brief Access to a pixel
+     *
+     * @param row Row index
+     * @param col Column index
+     * @return T& Pixel
+     */
+    T &operator()(::std::size_t row, ::std::size_t col) const noexcept
+    {
+        assert((row < rows) && (col < columns));
+        return ptr[(row * row_stride) + (col * column_stride)];
+    }
+
+    /**
+     * @brief Fill all pixels with a color
+     *
+     * @param color Color
+     */
+    void fill(const Pixel &color) const noexcept
+    {
+        for (::std::size_t r = 0; r < rows; r++)
+            for (::std::size_t c = 0; c < columns; c++)
+                (*this)(r, c) = color;
+    }
+
+    /**
+     * @brief Copy pixels from a matrix
+     *
+     * @note Pixels out of the smaller of both sizes are not copied
+     *
+     * @param source Pixel matrix
+     */
+    void assign(const PixelMatrix &source) const noexcept
+    {
+        ::std::size_t row_count = ::std::min(rows, source.row_count());
+        ::std::size_t col_count = ::std::min(columns, source.column_count());
+        for (::std::size_t r = 0; r < row_count; r++)
+            for (::std::size_t c = 0; c < col_count; c++)
+                (*this)(r, c) = source(r, c);
+    }
+
+    /**
+     * @brief Copy pixels into a matrix
+     *
+     * @param[out] destination Pixel matrix. Resized to this slice.
+     */
+    void copyTo(PixelMatrix &destination) const noexcept
+    {
+        destination.resize(rows, columns);
+        for (::std::size_t r = 0; r < rows; r++)
+            for (::std::size_t c = 0; c < columns; c++)
+                destination(r, c) = (*this)(r, c);
+    }
+};
+
+/// @brief Plane of pixels inside a pixel volume (non-owning)
+using PixelSlice = BasicPixelSlice<Pixel>;
+/// @brief Plane of read-only pixels inside a pixel volume (non-owning)
+using ConstPixelSlice = BasicPixelSlice<const Pixel>;
+
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Volume of pixels (for LED cubes)
+ *
+ * @note Coordinates: x is the column, y is the row
+ *       and z is the layer, being 0 the bottom one.
+ *       Pixels are stored layer by layer, each one in row-major order,
+ *       so a PixelVolume can be shown by an LED strip
+ *       having the wire map of a CubeLayout.
+ *
+ * @note Vector-wide operations (fill(), scale(), crossfade() and the like)
+ *       are inherited from PixelVector.
+ */
+struct PixelVolume : public PixelVector
+{
+    /**
+     * @brief Create an empty volume of pixels
+     *
+     */
+    PixelVolume() noexcept : PixelVector() {}
+
+    /**
+     * @brief Create a volume of pixels
+     *
+     * @param layers Number of layers (depth)
+     * @param rows Number of rows in each layer
+     * @param columns Number of columns in each layer
+     * @param color Initial color for all pixels
+     */
+    PixelVolume(
+        size_type layers,
+        size_type rows,
+        size_type columns,
+        Pixel color = 0) noexcept;
+
+    /**
+     * @brief Create a volume of pixels suitable for an LED cube
+     *
+     * @param layout LED cube
+     * @param color Initial color for all pixels
+     */
+    PixelVolume(const CubeLayout &layout, Pixel color = 0) noexcept
+        : PixelVolume(
+              layout.layer_count(),
+              layout.row_count(),
+              layout.column_count(),
+              color) {}
+
+    /**
+     * @brief Resize
+     *
+     * @param layers New number of layers
+     * @param rows New number of rows in each layer
+     * @param columns New number of columns in each layer
+     * @param color Initial color for all pixels
+     */
+    void resize(
+        size_type layers,
+        size_type rows,
+        size_type columns,
+        Pixel color = 0) noexcept;
+
+    /**
+     * @brief Get the number of layers
+     *
+     * @return size_type Number of layers
+     */
+    size_type layer_count() const noexcept { return layers; }
+
+    /**
+     * @brief Get the number of rows in each layer
+     *
+     * @return size_type Number of rows
+     */
+    size_type row_count() const noexcept { return rows; }
+
+    /**
+     * @brief Get the number of columns in each layer
+     *
+     * @return size_type Number of columns
+     */
+    size_type column_count() const noexcept { return columns; }
+
+    /**
+     * @brief Access to a pixel
+     *
+     * @note There are no bound checks, except for assertions.
+     *       Not tracked (see PixelVector::trackChanges()).
+     *
+     * @param x Column index
+     * @param y Row index
+     * @param z Layer index
+     * @return Pixel& Pixel
+     */
+    Pixel &operator()(size_type x, size_type y, size_type z) noexcept
+    {
+        assert((x < columns) && (y < rows) && (z < layers));
+        return data()[(((z * rows) + y) * columns) + x];
+    }
+
+    /**
+     * @brief Access to a pixel
+     *
+     * @note There are no bound checks, except for assertions
+     *
+     * @param x Column index
+     * @param y Row index
+     * @param z Layer index
+     * @return const Pixel& Pixel
+     */
+    const Pixel &operator()(
+        size_type x,
+        size_type y,
+        size_type z) const noexcept
+    {
+        assert((x < columns) && (y < rows) && (z < layers));
+        return data()[(((z * rows) + y) * columns) + x];
+    }
+
+    /**
+     * @brief Get a horizontal slice (a layer)
+     *
+     * @note The layer is marked as dirty
+     *
+     * @param z Layer index
+     * @return PixelSlice Rows and columns of the layer.
+     *                    Invalidated when the volume is resized.
+     */
+    PixelSlice sliceZ(size_type z) noexcept;
+
+    /**
+     * @brief Get a vertical slice at a given row
+     *
+     * @note All pixels are marked as dirty
+     *
+     * @param y Row index
+     * @return PixelSlice Slice whose rows are layers (bottom first)
+     *                    and whose columns are columns.
+     */
+    PixelSlice sliceY(size_type y) noexcept;
+
+    /**
+     * @brief Get a vertical slice at a given column
+     *
+     * @note All pixels are marked as dirty
+     *
+     * @param x Column index
+     * @return PixelSlice Slice whose rows are layers (bottom first)
+     *                    and whose columns are rows.
+     */
+    PixelSlice sliceX(size_type x) noexcept;
+
+    /**
+     * @brief Get a horizontal slice (a layer)
+     *
+     * @param z Layer index
+     * @return ConstPixelSlice Rows and columns of the layer
+     */
+    ConstPixelSlice sliceZ(size_type z) const noexcept;
+
+    /**
+     * @brief Get a vertical slice at a given row
+     *
+     * @param y Row index
+     * @return ConstPixelSlice Slice whose rows are layers (bottom first)
+     *                         and whose columns are columns.
+     */
+    ConstPixelSlice sliceY(size_type y) const noexcept;
+
+    /**
+     * @brief Get a vertical slice at a given column
+     *
+     * @param x Column index
+     * @return ConstPixelSlice Slice whose rows are layers (bottom first)
+     *                         and whose columns are rows.
+     */
+    ConstPixelSlice sliceX(size_type x) const noexcept;
+
+private:
+    /// @brief Number of layers
+    size_type layers = 0;
+    /// @brief Number of rows in each layer
+    size_type rows = 0;
+    /// @brief Number of columns in each layer
+    size_type columns = 0;
+};
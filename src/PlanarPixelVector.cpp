@@ -0,0 +1,261 @@
+/**
+ * @file PlanarPixelVector.cpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Vectors of pixels stored as separate color planes
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 License
+ */
+
+#include "PlanarPixelVector.hpp"
+#include "PixelMath.hpp" // For PixelMath::blendWeight()
+#include <algorithm>     // For ::std::min()
+#include <cstring>       // For ::std::memset() and ::std::memcpy()
+
+//------------------------------------------------------------------------------
+// Kernels
+//------------------------------------------------------------------------------
+
+// Note: bytes are processed in blocks of fixed size.
+// Each block is copied into local storage, so the compiler knows there is
+// no aliasing and the trip count is constant. As a result, the inner loops
+// are vectorized even at the default optimization level.
+
+/// @brief Count of bytes processed at once
+static constexpr ::std::size_t plane_block = 16;
+
+/**
+ * @brief Apply a byte-wise operation to a plane in place
+ *
+ * @tparam Operation Callable as uint8_t(uint8_t)
+ * @param plane Bytes to transform
+ * @param count Count of bytes
+ * @param op Operation
+ */
+template <typename Operation>
+static inline void apply_plane(
+    uint8_t *plane,
+    ::std::size_t count,
+    Operation op) noexcept
+{
+    ::std::size_t i = 0;
+    for (; (i + plane_block) <= count; i += plane_block)
+    {
+        uint8_t block[plane_block];
+        ::std::memcpy(block, plane + i, plane_block);
+        for (::std::size_t j = 0; j < plane_block; j++)
+            block[j] = op(block[j]);
+        ::std::memcpy(plane + i, block, plane_block);
+    }
+    for (; i < count; i++)
+        plane[i] = op(plane[i]);
+}
+
+/**
+ * @brief Apply a byte-wise operation to two planes
+ *
+ * @tparam Operation Callable as uint8_t(uint8_t,uint8_t)
+ * @param plane Destination
+ * @param a First operand
+ * @param b Second operand
+ * @param count Count of bytes
+ * @param op Operation
+ */
+template <typename Operation>
+static inline void apply_plane(
+    uint8_t *plane,
+    const uint8_t *a,
+    const uint8_t *b,
+    ::std::size_t count,
+    Operation op) noexcept
+{
+    ::std::size_t i = 0;
+    for (; (i + plane_block) <= count; i += plane_block)
+    {
+        uint8_t block_a[plane_block];
+        uint8_t block_b[plane_block];
+        ::std::memcpy(block_a, a + i, plane_block);
+        ::std::memcpy(block_b, b + i, plane_block);
+        for (::std::size_t j = 0; j < plane_block; j++)
+            block_a[j] = op(block_a[j], block_b[j]);
+        ::std::memcpy(plane + i, block_a, plane_block);
+    }
+    for (; i < count; i++)
+        plane[i] = op(a[i], b[i]);
+}
+
+/**
+ * @brief Map a plane through a lookup table
+ *
+ * @note Table lookups are not vectorized,
+ *       but each plane is walked once with no pixel unpacking
+ *
+ * @param plane Bytes to map (in place)
+ * @param count Count of bytes
+ * @param table 256 entries or null
+ */
+static void map_plane(
+    uint8_t *plane,
+    ::std::size_t count,
+    const uint8_t *table) noexcept
+{
+    if (table)
+        for (::std::size_t i = 0; i < count; i++)
+            plane[i] = table[plane[i]];
+}
+
+//------------------------------------------------------------------------------
+// Size and conversion
+//------------------------------------------------------------------------------
+
+PlanarPixelVector::PlanarPixelVector(size_type count, const Pixel &color)
+    : red_plane(count, color.red),
+      green_plane(count, color.green),
+      blue_plane(count, color.blue)
+{
+}
+
+void PlanarPixelVector::resize(size_type count, const Pixel &color)
+{
+    red_plane.resize(count, color.red);
+    green_plane.resize(count, color.green);
+    blue_plane.resize(count, color.blue);
+}
+
+void PlanarPixelVector::assign(const PixelVector &pixels)
+{
+    size_type count = pixels.size();
+    red_plane.resize(count);
+    green_plane.resize(count);
+    blue_plane.resize(count);
+    uint8_t *r = red_plane.data();
+    uint8_t *g = green_plane.data();
+    uint8_t *b = blue_plane.data();
+    const Pixel *pixel = pixels.data();
+    for (size_type i = 0; i < count; i++)
+    {
+        r[i] = pixel[i].red;
+        g[i] = pixel[i].green;
+        b[i] = pixel[i].blue;
+    }
+}
+
+void PlanarPixelVector::toPixels(PixelVector &pixels) const
+{
+    size_type count = size();
+    pixels.resize(count);
+    const uint8_t *r = red_plane.data();
+    const uint8_t *g = green_plane.data();
+    const uint8_t *b = blue_plane.data();
+    Pixel *pixel = pixels.data();
+    for (size_type i = 0; i < count; i++)
+    {
+        pixel[i].red = r[i];
+        pixel[i].green = g[i];
+        pixel[i].blue = b[i];
+    }
+    pixels.markDirty();
+}
+
+//------------------------------------------------------------------------------
+// Bulk operations
+//------------------------------------------------------------------------------
+
+void PlanarPixelVector::fill(const Pixel &color) noexcept
+{
+    if (size())
+    {
+        ::std::memset(red_plane.data(), color.red, size());
+        ::std::memset(green_plane.data(), color.green, size());
+        ::std::memset(blue_plane.data(), color.blue, size());
+    }
+}
+
+void PlanarPixelVector::scale(uint8_t factor) noexcept
+{
+    scale(factor, factor, factor);
+}
+
+void PlanarPixelVector::scale(
+    uint8_t red_factor,
+    uint8_t green_factor,
+    uint8_t blue_factor) noexcept
+{
+    uint8_t *plane[3] = {red(), green(), blue()};
+    uint16_t factor[3] = {
+        static_cast<uint16_t>(red_factor + 1),
+        static_cast<uint16_t>(green_factor + 1),
+        static_cast<uint16_t>(blue_factor + 1)};
+    for (int p = 0; p < 3; p++)
+    {
+        uint16_t f = factor[p];
+        apply_plane(
+            plane[p],
+            size(),
+            [f](uint8_t b) -> uint8_t
+            { return (b * f) >> 8; });
+    }
+}
+
+void PlanarPixelVector::blendAdd(const PlanarPixelVector &other) noexcept
+{
+    size_type count = ::std::min(size(), other.size());
+    uint8_t *plane[3] = {red(), green(), blue()};
+    const uint8_t *source[3] = {other.red(), other.green(), other.blue()};
+    for (int p = 0; p < 3; p++)
+        apply_plane(
+            plane[p],
+            plane[p],
+            source[p],
+            count,
+            [](uint8_t a, uint8_t b) -> uint8_t
+            { return ((a + b) > 255) ? 255 : (a + b); });
+}
+
+void PlanarPixelVector::blendMax(const PlanarPixelVector &other) noexcept
+{
+    size_type count = ::std::min(size(), other.size());
+    uint8_t *plane[3] = {red(), green(), blue()};
+    const uint8_t *source[3] = {other.red(), other.green(), other.blue()};
+    for (int p = 0; p < 3; p++)
+        apply_plane(
+            plane[p],
+            plane[p],
+            source[p],
+            count,
+            [](uint8_t a, uint8_t b) -> uint8_t
+            { return (a > b) ? a : b; });
+}
+
+void PlanarPixelVector::crossfade(
+    const PlanarPixelVector &from,
+    const PlanarPixelVector &to,
+    uint8_t amount) noexcept
+{
+    size_type count = ::std::min({size(), from.size(), to.size()});
+    uint16_t w = PixelMath::blendWeight(amount);
+    uint16_t complement = 256 - w;
+    uint8_t *plane[3] = {red(), green(), blue()};
+    const uint8_t *a[3] = {from.red(), from.green(), from.blue()};
+    const uint8_t *b[3] = {to.red(), to.green(), to.blue()};
+    for (int p = 0; p < 3; p++)
+        apply_plane(
+            plane[p],
+            a[p],
+            b[p],
+            count,
+            [w, complement](uint8_t a, uint8_t b) -> uint8_t
+            { return ((a * complement) + (b * w)) >> 8; });
+}
+
+void PlanarPixelVector::applyTables(
+    const uint8_t *red_table,
+    const uint8_t *green_table,
+    const uint8_t *blue_table) noexcept
+{
+    map_plane(red_plane.data(), size(), red_table);
+    map_plane(green_plane.data(), size(), green_table);
+    map_plane(blue_plane.data(), size(), blue_table);
+}
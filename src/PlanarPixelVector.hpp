@@ -0,0 +1,264 @@
+/**
+ * @file PlanarPixelVector.hpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Vectors of pixels stored as separate color planes
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 License
+ */
+
+#pragma once
+
+//------------------------------------------------------------------------------
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "PixelVector.hpp"
+
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Vector of pixels stored as three separate planes
+ *        (red, green and blue)
+ *
+ * @note Each plane is a contiguous array of bytes,
+ *       so per-channel math runs as plain byte loops
+ *       which the compiler is able to vectorize.
+ *       Use this class for heavy per-channel processing
+ *       and PixelVector for per-pixel access.
+ */
+class PlanarPixelVector
+{
+public:
+    /// @brief Size type of this vector
+    using size_type = ::std::size_t;
+
+    /**
+     * @brief Create an empty vector
+     *
+     */
+    PlanarPixelVector() noexcept {}
+
+    /**
+     * @brief Create a vector filled with a color
+     *
+     * @param count Count of pixels
+     * @param color Color of all pixels
+     */
+    explicit PlanarPixelVector(size_type count, const Pixel &color = Pixel());
+
+    /**
+     * @brief Create a vector from interleaved pixels
+     *
+     * @param pixels Pixels to copy
+     */
+    explicit PlanarPixelVector(const PixelVector &pixels) { assign(pixels); }
+
+    /**
+     * @brief Get the count of pixels
+     *
+     * @return size_type Count of pixels
+     */
+    size_type size() const noexcept { return red_plane.size(); }
+
+    /**
+     * @brief Change the count of pixels
+     *
+     * @param count New count of pixels
+     * @param color Color of the new pixels, if any
+     */
+    void resize(size_type count, const Pixel &color = Pixel());
+
+    /**
+     * @brief Get the red plane
+     *
+     * @return uint8_t* Red channel of all pixels
+     */
+    uint8_t *red() noexcept { return red_plane.data(); }
+
+    /**
+     * @brief Get the red plane
+     *
+     * @return const uint8_t* Red channel of all pixels
+     */
+    const uint8_t *red() const noexcept { return red_plane.data(); }
+
+    /**
+     * @brief Get the green plane
+     *
+     * @return uint8_t* Green channel of all pixels
+     */
+    uint8_t *green() noexcept { return green_plane.data(); }
+
+    /**
+     * @brief Get the green plane
+     *
+     * @return const uint8_t* Green channel of all pixels
+     */
+    const uint8_t *green() const noexcept { return green_plane.data(); }
+
+    /**
+     * @brief Get the blue plane
+     *
+     * @return uint8_t* Blue channel of all pixels
+     */
+    uint8_t *blue() noexcept { return blue_plane.data(); }
+
+    /**
+     * @brief Get the blue plane
+     *
+     * @return const uint8_t* Blue channel of all pixels
+     */
+    const uint8_t *blue() const noexcept { return blue_plane.data(); }
+
+    /**
+     * @brief Get the color of a pixel
+     *
+     * @note No bounds checking
+     *
+     * @param index Pixel index
+     * @return Pixel Color of the pixel at @p index
+     */
+    Pixel color(size_type index) const noexcept
+    {
+        Pixel result;
+        result.red = red_plane.data()[index];
+        result.green = green_plane.data()[index];
+        result.blue = blue_plane.data()[index];
+        return result;
+    }
+
+    /**
+     * @brief Set the color of a pixel
+     *
+     * @note No bounds checking
+     *
+     * @param index Pixel index
+     * @param color New color of the pixel at @p index
+     */
+    void color(size_type index, const Pixel &color) noexcept
+    {
+        red_plane.data()[index] = color.red;
+        green_plane.data()[index] = color.green;
+        blue_plane.data()[index] = color.blue;
+    }
+
+    /**
+     * @brief Copy interleaved pixels into this vector
+     *
+     * @param pixels Pixels to copy.
+     *               This vector is resized to the size of @p pixels.
+     */
+    void assign(const PixelVector &pixels);
+
+    /**
+     * @brief Copy this vector into interleaved pixels
+     *
+     * @param pixels Destination. Resized to the size of this vector.
+     */
+    void toPixels(PixelVector &pixels) const;
+
+    /**
+     * @brief Fill the entire vector with a single color
+     *
+     * @param color Fill color
+     */
+    void fill(const Pixel &color) noexcept;
+
+    /**
+     * @brief Scale all channels of all pixels
+     *
+     * @note Same result as PixelVector::scale()
+     *
+     * @param factor Scale factor in the range [0,255].
+     *               255 keeps the pixels as they are.
+     */
+    void scale(uint8_t factor) noexcept;
+
+    /**
+     * @brief Scale the channels of all pixels (one factor per channel)
+     *
+     * @note Color grading. 255 keeps the channel as it is.
+     *
+     * @param red_factor Scale factor of the red channel
+     * @param green_factor Scale factor of the green channel
+     * @param blue_factor Scale factor of the blue channel
+     */
+    void scale(
+        uint8_t red_factor,
+        uint8_t green_factor,
+        uint8_t blue_factor) noexcept;
+
+    /**
+     * @brief Fade all pixels to black
+     *
+     * @note Same result as PixelVector::fadeToBlackBy()
+     *
+     * @param amount Fade amount in the range [0,255].
+     *               0 keeps the pixels as they are.
+     */
+    void fadeToBlackBy(uint8_t amount) noexcept
+    {
+        scale(255 - amount);
+    }
+
+    /**
+     * @brief Add another vector, channel by channel, saturating at 255
+     *
+     * @note Only the first min(size(),other.size()) pixels are affected
+     *
+     * @param other Pixels to add
+     */
+    void blendAdd(const PlanarPixelVector &other) noexcept;
+
+    /**
+     * @brief Keep the maximum of each channel
+     *
+     * @note Only the first min(size(),other.size()) pixels are affected
+     *
+     * @param other Pixels to compare with
+     */
+    void blendMax(const PlanarPixelVector &other) noexcept;
+
+    /**
+     * @brief Blend two vectors into this one
+     *
+     * @note Same result as PixelVector::crossfade().
+     *       Only the first min(size(),from.size(),to.size())
+     *       pixels are affected.
+     *
+     * @param from First vector
+     * @param to Second vector
+     * @param amount Blend amount. 0 means @p from. 255 means @p to.
+     */
+    void crossfade(
+        const PlanarPixelVector &from,
+        const PlanarPixelVector &to,
+        uint8_t amount) noexcept;
+
+    /**
+     * @brief Map each channel through a lookup table
+     *
+     * @note Color grading, gamma correction and the like.
+     *       Any table may be null, meaning no change to that channel.
+     *
+     * @param red_table 256 entries for the red channel
+     * @param green_table 256 entries for the green channel
+     * @param blue_table 256 entries for the blue channel
+     */
+    void applyTables(
+        const uint8_t *red_table,
+        const uint8_t *green_table,
+        const uint8_t *blue_table) noexcept;
+
+private:
+    /// @brief Red channel of all pixels
+    ::std::vector<uint8_t> red_plane;
+    /// @brief Green channel of all pixels
+    ::std::vector<uint8_t> green_plane;
+    /// @brief Blue channel of all pixels
+    ::std::vector<uint8_t> blue_plane;
+};
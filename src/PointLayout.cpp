@@ -0,0 +1,245 @@
+/**
+ * @file PointLayout.cpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief LEDs placed at arbitrary coordinates
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 License
+ */
+
+#include "PointLayout.hpp"
+#include <algorithm> // For ::std::min() and ::std::max()
+#include <cassert>
+#include <cmath> // For ::std::atan2()
+
+//------------------------------------------------------------------------------
+// Auxiliary
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Integer square root
+ *
+ * @param value Radicand
+ * @return uint32_t Square root (rounded down)
+ */
+static uint32_t isqrt(uint64_t value) noexcept
+{
+    uint64_t result = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+    while (bit > value)
+        bit >>= 2;
+    while (bit)
+    {
+        if (value >= result + bit)
+        {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        }
+        else
+            result >>= 1;
+        bit >>= 2;
+    }
+    return result;
+}
+
+/**
+ * @brief Read a signed 16-bit little-endian value
+ *
+ * @param ptr Pointer to the first byte
+ * @return int16_t Value
+ */
+static int16_t read_int16(const uint8_t *ptr) noexcept
+{
+    return static_cast<int16_t>(ptr[0] | (ptr[1] << 8));
+}
+
+/**
+ * @brief Scale a coordinate to a canvas axis
+ *
+ * @param value Coordinate
+ * @param min Minimum coordinate
+ * @param max Maximum coordinate
+ * @param count Count of pixels in the canvas axis
+ * @return ::std::size_t Nearest pixel in the canvas axis
+ */
+static ::std::size_t to_canvas(
+    int32_t value,
+    int32_t min,
+    int32_t max,
+    ::std::size_t count) noexcept
+{
+    if (max == min)
+        return (count - 1) / 2;
+    int64_t span = max - min;
+    return (((int64_t)(value - min) * (count - 1)) + (span / 2)) / span;
+}
+
+//------------------------------------------------------------------------------
+// Construction
+//------------------------------------------------------------------------------
+
+PointLayout::PointLayout(const LedPoint *points, ::std::size_t count)
+    : points(points, points + count)
+{
+    build();
+}
+
+PointLayout::PointLayout(const uint8_t *blob, ::std::size_t size)
+{
+    assert(size > 0);
+    ::std::size_t dimensions = blob[0];
+    assert((dimensions == 2) || (dimensions == 3));
+    ::std::size_t stride = dimensions * sizeof(int16_t);
+    ::std::size_t count = (size - 1) / stride;
+    points.resize(count);
+    const uint8_t *ptr = blob + 1;
+    for (::std::size_t i = 0; i < count; i++)
+    {
+        points[i].x = read_int16(ptr);
+        points[i].y = read_int16(ptr + 2);
+        if (dimensions == 3)
+            points[i].z = read_int16(ptr + 4);
+        ptr += stride;
+    }
+    build();
+}
+
+::std::vector<uint8_t> PointLayout::blob() const
+{
+    bool has_z = false;
+    for (const LedPoint &p : points)
+        has_z = has_z || (p.z != 0);
+    ::std::size_t dimensions = has_z ? 3 : 2;
+    ::std::vector<uint8_t> result;
+    result.reserve(1 + (points.size() * dimensions * sizeof(int16_t)));
+    result.push_back(dimensions);
+    for (const LedPoint &p : points)
+    {
+        int16_t coordinate[3] = {p.x, p.y, p.z};
+        for (::std::size_t d = 0; d < dimensions; d++)
+        {
+            result.push_back(coordinate[d] & 0xFF);
+            result.push_back((coordinate[d] >> 8) & 0xFF);
+        }
+    }
+    return result;
+}
+
+void PointLayout::build()
+{
+    assert(points.size() < 65536);
+    // Bounds
+    min_point = LedPoint();
+    max_point = LedPoint();
+    if (points.size())
+    {
+        min_point = points[0];
+        max_point = points[0];
+    }
+    for (const LedPoint &p : points)
+    {
+        min_point.x = ::std::min(min_point.x, p.x);
+        min_point.y = ::std::min(min_point.y, p.y);
+        min_point.z = ::std::min(min_point.z, p.z);
+        max_point.x = ::std::max(max_point.x, p.x);
+        max_point.y = ::std::max(max_point.y, p.y);
+        max_point.z = ::std::max(max_point.z, p.z);
+    }
+
+    // Polar coordinates
+    center(
+        (static_cast<int32_t>(min_point.x) + max_point.x) / 2,
+        (static_cast<int32_t>(min_point.y) + max_point.y) / 2);
+
+    // Spatial index: about one LED per cell, cells are square
+    uint32_t width = (max_point.x - min_point.x) + 1;
+    uint32_t height = (max_point.y - min_point.y) + 1;
+    uint32_t cells_per_side = ::std::max<uint32_t>(1, isqrt(points.size()));
+    cell_size = (::std::max(width, height) + cells_per_side - 1) /
+                cells_per_side;
+    grid_columns = (width + cell_size - 1) / cell_size;
+    grid_rows = (height + cell_size - 1) / cell_size;
+    // Note: counting sort of LED indices by cell
+    ::std::vector<::std::size_t> cell_of(points.size());
+    cell_start.assign((grid_columns * grid_rows) + 1, 0);
+    for (::std::size_t i = 0; i < points.size(); i++)
+    {
+        ::std::size_t column = (points[i].x - min_point.x) / cell_size;
+        ::std::size_t row = (points[i].y - min_point.y) / cell_size;
+        cell_of[i] = (row * grid_columns) + column;
+        cell_start[cell_of[i] + 1]++;
+    }
+    for (::std::size_t cell = 1; cell < cell_start.size(); cell++)
+        cell_start[cell] += cell_start[cell - 1];
+    cell_items.resize(points.size());
+    ::std::vector<index_type> next(cell_start.begin(), cell_start.end() - 1);
+    for (::std::size_t i = 0; i < points.size(); i++)
+        cell_items[next[cell_of[i]]++] = i;
+}
+
+void PointLayout::center(int16_t x, int16_t y)
+{
+    // Note: computed once, so floating point is not an issue here
+    constexpr double units_per_radian = 32768.0 / 3.14159265358979323846;
+    angles.resize(points.size());
+    radii.resize(points.size());
+    for (::std::size_t i = 0; i < points.size(); i++)
+    {
+        int32_t dx = points[i].x - x;
+        int32_t dy = points[i].y - y;
+        double angle = ::std::atan2(dy, dx) * units_per_radian;
+        // Note: negative angles wrap around
+        angles[i] = static_cast<uint16_t>(
+            static_cast<int32_t>(::std::lround(angle)));
+        uint32_t r = isqrt(((int64_t)dx * dx) + ((int64_t)dy * dy));
+        radii[i] = (r > 65535) ? 65535 : r;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Queries
+//------------------------------------------------------------------------------
+
+bool PointLayout::cellRange(
+    int32_t coordinate,
+    uint32_t distance,
+    ::std::size_t &first,
+    ::std::size_t &last,
+    bool vertical) const noexcept
+{
+    int64_t origin = vertical ? min_point.y : min_point.x;
+    ::std::size_t count = vertical ? grid_rows : grid_columns;
+    int64_t low = (int64_t)coordinate - distance - origin;
+    int64_t high = (int64_t)coordinate + distance - origin;
+    if ((count == 0) || (high < 0))
+        return false;
+    first = (low < 0) ? 0 : (low / cell_size);
+    if (first >= count)
+        return false;
+    last = ::std::min<::std::size_t>(high / cell_size, count - 1);
+    return true;
+}
+
+WireMap PointLayout::wireMap(
+    ::std::size_t row_count,
+    ::std::size_t column_count) const
+{
+    if ((row_count == 0) ||
+        (column_count == 0) ||
+        !WireMap::fits(row_count, column_count))
+        return WireMap();
+    WireMap map(points.size());
+    map.row_count = row_count;
+    map.column_count = column_count;
+    for (::std::size_t i = 0; i < points.size(); i++)
+    {
+        ::std::size_t column =
+            to_canvas(points[i].x, min_point.x, max_point.x, column_count);
+        ::std::size_t row =
+            to_canvas(points[i].y, min_point.y, max_point.y, row_count);
+        map[i] = (row * column_count) + column;
+    }
+    return map;
+}
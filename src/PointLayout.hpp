@@ -0,0 +1,258 @@
+/**
+ * @file PointLayout.hpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief LEDs placed at arbitrary coordinates
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 License
+ */
+
+#pragma once
+
+//------------------------------------------------------------------------------
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "WireMap.hpp"
+
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Coordinates of an LED
+ *
+ * @note Units are up to you (millimeters, for example).
+ *       X grows to the right and Y grows downwards,
+ *       as columns and rows do in a PixelMatrix.
+ */
+struct LedPoint
+{
+    /// @brief Horizontal coordinate
+    int16_t x = 0;
+    /// @brief Vertical coordinate
+    int16_t y = 0;
+    /// @brief Depth coordinate (not used in 2D layouts)
+    int16_t z = 0;
+};
+
+//------------------------------------------------------------------------------
+
+/**
+ * @brief LEDs placed at arbitrary coordinates
+ *        (rings, spirals, sculptures, outlines and the like)
+ *
+ * @note The i-th point is the location of the i-th LED in the data wire.
+ *
+ * @note Polar coordinates and a spatial index (a uniform grid over
+ *       the X and Y coordinates) are precomputed at construction,
+ *       so spatial queries do not visit every LED.
+ *
+ * @note To show a PixelMatrix (canvas) stretched over the layout,
+ *       install wireMap() into the LED strip.
+ */
+class PointLayout
+{
+public:
+    /// @brief Type of LED indices in the spatial index
+    using index_type = uint16_t;
+
+    /**
+     * @brief Create a layout from an array of points
+     *
+     * @param points Location of each LED in wire order
+     *               (may be a constexpr array). Copied.
+     * @param count Count of LEDs
+     */
+    PointLayout(const LedPoint *points, ::std::size_t count);
+
+    /**
+     * @brief Create a layout from a compact binary blob
+     *
+     * @note Blob format: one byte holding the count of coordinates
+     *       per point (2 or 3), followed by that many
+     *       signed 16-bit little-endian coordinates per point (x, y[, z]).
+     *       See blob().
+     *
+     * @param blob Binary data
+     * @param size Size of @p blob in bytes
+     */
+    PointLayout(const uint8_t *blob, ::std::size_t size);
+
+    /**
+     * @brief Serialize this layout into a compact binary blob
+     *
+     * @note Z coordinates are omitted if all of them are zero
+     *
+     * @return ::std::vector<uint8_t> Binary data
+     */
+    ::std::vector<uint8_t> blob() const;
+
+    /**
+     * @brief Get the count of LEDs
+     *
+     * @return ::std::size_t Count of LEDs
+     */
+    ::std::size_t size() const noexcept { return points.size(); }
+
+    /**
+     * @brief Get the location of an LED
+     *
+     * @param index LED index in wire order
+     * @return const LedPoint& Coordinates
+     */
+    const LedPoint &point(::std::size_t index) const noexcept
+    {
+        return points[index];
+    }
+
+    /**
+     * @brief Get the bounding box of all LEDs
+     *
+     * @param[out] min Minimum coordinates
+     * @param[out] max Maximum coordinates
+     */
+    void bounds(LedPoint &min, LedPoint &max) const noexcept
+    {
+        min = min_point;
+        max = max_point;
+    }
+
+    /**
+     * @brief Set the origin of polar coordinates
+     *
+     * @note The default origin is the center of the bounding box
+     *
+     * @param x Horizontal coordinate
+     * @param y Vertical coordinate
+     */
+    void center(int16_t x, int16_t y);
+
+    /**
+     * @brief Get the angle of an LED around the origin
+     *
+     * @note Use it as a 16-bit hue (see Pixel::hsl16())
+     *       to paint a color wheel
+     *
+     * @param index LED index in wire order
+     * @return uint16_t Angle. 65536 units are 360 degrees, clockwise
+     *         starting at the positive X axis.
+     */
+    uint16_t angle(::std::size_t index) const noexcept
+    {
+        return angles[index];
+    }
+
+    /**
+     * @brief Get the distance from an LED to the origin
+     *
+     * @param index LED index in wire order
+     * @return uint16_t Distance (rounded down)
+     */
+    uint16_t radius(::std::size_t index) const noexcept
+    {
+        return radii[index];
+    }
+
+    /**
+     * @brief Visit all LEDs within a distance to a given point
+     *
+     * @note Only grid cells overlapping the circle are visited
+     *
+     * @tparam Visitor Callable type: void(::std::size_t index)
+     * @param x Horizontal coordinate of the center
+     * @param y Vertical coordinate of the center
+     * @param distance Maximum distance (inclusive)
+     * @param visitor Called once for each LED index in the circle
+     */
+    template <typename Visitor>
+    void forEachWithin(
+        int32_t x,
+        int32_t y,
+        uint32_t distance,
+        Visitor visitor) const
+    {
+        ::std::size_t first_column, last_column, first_row, last_row;
+        if (!cellRange(x, distance, first_column, last_column, false) ||
+            !cellRange(y, distance, first_row, last_row, true))
+            return;
+        int64_t max_squared = (int64_t)distance * distance;
+        for (::std::size_t row = first_row; row <= last_row; row++)
+        {
+            ::std::size_t cell = (row * grid_columns);
+            for (::std::size_t i = cell_start[cell + first_column];
+                 i < cell_start[cell + last_column + 1];
+                 i++)
+            {
+                const LedPoint &p = points[cell_items[i]];
+                int64_t dx = p.x - x;
+                int64_t dy = p.y - y;
+                if (((dx * dx) + (dy * dy)) <= max_squared)
+                    visitor(cell_items[i]);
+            }
+        }
+    }
+
+    /**
+     * @brief Build the wire map to show a canvas stretched over this layout
+     *
+     * @note Each LED shows the canvas pixel nearest to its location,
+     *       once the bounding box is scaled to the canvas size.
+     *       Several LEDs may show the same canvas pixel.
+     *
+     * @param row_count Number of rows in the canvas
+     * @param column_count Number of columns in the canvas
+     * @return WireMap Wire map to be installed into an LED strip.
+     *                 Empty if the canvas is empty or has more than
+     *                 WireMap::max_canvas_size pixels.
+     */
+    WireMap wireMap(::std::size_t row_count, ::std::size_t column_count) const;
+
+private:
+    /// @brief Location of each LED
+    ::std::vector<LedPoint> points;
+    /// @brief Minimum coordinates
+    LedPoint min_point;
+    /// @brief Maximum coordinates
+    LedPoint max_point;
+    /// @brief Polar angle of each LED
+    ::std::vector<uint16_t> angles;
+    /// @brief Polar radius of each LED
+    ::std::vector<uint16_t> radii;
+    /// @brief Width and height of a grid cell
+    uint32_t cell_size = 1;
+    /// @brief Number of columns in the grid
+    ::std::size_t grid_columns = 0;
+    /// @brief Number of rows in the grid
+    ::std::size_t grid_rows = 0;
+    /// @brief Position of the first LED of each cell in cell_items
+    /// @note One more entry than cells
+    ::std::vector<index_type> cell_start;
+    /// @brief LED indices sorted by cell
+    ::std::vector<index_type> cell_items;
+
+    /**
+     * @brief Compute bounds, polar coordinates and the spatial index
+     *
+     */
+    void build();
+
+    /**
+     * @brief Compute the range of grid cells along one axis
+     *
+     * @param coordinate Center of the range
+     * @param distance Half the range width
+     * @param[out] first First cell
+     * @param[out] last Last cell (inclusive)
+     * @param vertical True for rows, false for columns
+     * @return true If the range overlaps the grid
+     * @return false Otherwise
+     */
+    bool cellRange(
+        int32_t coordinate,
+        uint32_t distance,
+        ::std::size_t &first,
+        ::std::size_t &last,
+        bool vertical) const noexcept;
+};
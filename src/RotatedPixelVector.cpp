@@ -0,0 +1,104 @@
+/**
+ * @file RotatedPixelVector.cpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Ring-buffer view of a pixel vector or matrix
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 License
+ */
+
+#include "RotatedPixelVector.hpp"
+#include <algorithm> // For ::std::rotate()
+
+//------------------------------------------------------------------------------
+// Rotation
+//------------------------------------------------------------------------------
+
+void RotatedPixelVector::rotate(::std::ptrdiff_t count) noexcept
+{
+    size_type n = size();
+    if (n > 1)
+    {
+        // Note: a row rotation is applied before the whole rotation
+        // in physicalIndex(), so they only commute if whole rows move
+        size_type magnitude =
+            static_cast<size_type>((count >= 0) ? count : -count);
+        if (column_offset && (magnitude % row_length))
+            compact();
+        if (count >= 0)
+            offset += n - (static_cast<size_type>(count) % n);
+        else
+            offset += static_cast<size_type>(-count) % n;
+        offset %= n;
+        storage->markDirty();
+    }
+}
+
+void RotatedPixelVector::rotate_left(size_type count) noexcept
+{
+    if (row_length < 2)
+        return;
+    if (row_length == size())
+        // Note: a single row rotates as a whole, without modulo per pixel
+        rotate(-static_cast<::std::ptrdiff_t>(count % row_length));
+    else
+    {
+        column_offset = (column_offset + (count % row_length)) % row_length;
+        storage->markDirty();
+    }
+}
+
+void RotatedPixelVector::rotate_right(size_type count) noexcept
+{
+    if (row_length < 2)
+        return;
+    if (row_length == size())
+        rotate(static_cast<::std::ptrdiff_t>(count % row_length));
+    else
+    {
+        column_offset =
+            (column_offset + row_length - (count % row_length)) % row_length;
+        storage->markDirty();
+    }
+}
+
+void RotatedPixelVector::rotate_up(size_type count) noexcept
+{
+    size_type rows = (row_length) ? (size() / row_length) : 0;
+    if (rows > 1)
+    {
+        offset = (offset + ((count % rows) * row_length)) % size();
+        storage->markDirty();
+    }
+}
+
+void RotatedPixelVector::rotate_down(size_type count) noexcept
+{
+    size_type rows = (row_length) ? (size() / row_length) : 0;
+    if (rows > 1)
+    {
+        offset = (offset + size() - ((count % rows) * row_length)) % size();
+        storage->markDirty();
+    }
+}
+
+void RotatedPixelVector::compact() noexcept
+{
+    if (!rotated())
+        return;
+    if (offset)
+        ::std::rotate(
+            storage->begin(),
+            storage->begin() + offset,
+            storage->end());
+    if (column_offset)
+        for (auto row = storage->begin();
+             row < storage->end();
+             row += row_length)
+            ::std::rotate(row, row + column_offset, row + row_length);
+    offset = 0;
+    column_offset = 0;
+    storage->markDirty();
+}
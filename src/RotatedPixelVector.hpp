@@ -0,0 +1,232 @@
+/**
+ * @file RotatedPixelVector.hpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Ring-buffer view of a pixel vector or matrix
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 License
+ */
+
+#pragma once
+
+//------------------------------------------------------------------------------
+
+#include <cstddef>
+#include <cassert>
+#include "PixelVector.hpp"
+
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Rotated view of a pixel vector or matrix (ring buffer)
+ *
+ * @note Rotations are O(1): pixels are not moved in memory
+ *       until compact() is called. The rotation is applied
+ *       when indexing through this view and when showing it
+ *       (see LEDStrip::show()).
+ *
+ * @note The underlying pixels must outlive this view and must not be
+ *       resized while rotated. Call compact() first.
+ *
+ * @note Writes through this view are not tracked
+ *       (see PixelVector::trackChanges()). Rotations are.
+ */
+class RotatedPixelVector
+{
+public:
+    /// @brief Size type
+    using size_type = PixelVector::size_type;
+
+    /**
+     * @brief Create a view of a pixel vector (not rotated)
+     *
+     * @note The vector is handled as a single row
+     *
+     * @param pixels Underlying pixels
+     */
+    RotatedPixelVector(PixelVector &pixels) noexcept
+        : storage{&pixels}, row_length{pixels.size()} {}
+
+    /**
+     * @brief Create a view of a pixel matrix (not rotated)
+     *
+     * @param pixels Underlying pixels
+     */
+    RotatedPixelVector(PixelMatrix &pixels) noexcept
+        : storage{&pixels}, row_length{pixels.column_count()} {}
+
+    /**
+     * @brief Get the underlying pixels
+     *
+     * @note They are in physical (non-rotated) order
+     *
+     * @return PixelVector& Underlying pixels
+     */
+    PixelVector &pixels() const noexcept { return *storage; }
+
+    /**
+     * @brief Get the number of pixels
+     *
+     * @return size_type Number of pixels
+     */
+    size_type size() const noexcept { return storage->size(); }
+
+    /**
+     * @brief Rotate all pixels without moving them
+     *
+     * @note If there is a pending row rotation (see rotate_left())
+     *       and @p count is not a multiple of the row length,
+     *       the pending rotation is applied first (see compact())
+     *
+     * @param count Rotation count. A positive count rotates up (right)
+     *              as PixelVector::operator>>() does. A negative count
+     *              rotates down (left) as PixelVector::operator<<() does.
+     */
+    void rotate(::std::ptrdiff_t count) noexcept;
+
+    /**
+     * @brief Rotate each row left without moving pixels
+     *
+     * @note Same result as PixelMatrix::operator<<()
+     *
+     * @param count Rotation count
+     */
+    void rotate_left(size_type count) noexcept;
+
+    /**
+     * @brief Rotate each row right without moving pixels
+     *
+     * @note Same result as PixelMatrix::operator>>()
+     *
+     * @param count Rotation count
+     */
+    void rotate_right(size_type count) noexcept;
+
+    /**
+     * @brief Rotate rows up without moving pixels
+     *
+     * @note Same result as PixelMatrix::scroll_up()
+     *
+     * @param count Rotation count
+     */
+    void rotate_up(size_type count) noexcept;
+
+    /**
+     * @brief Rotate rows down without moving pixels
+     *
+     * @note Same result as PixelMatrix::scroll_down()
+     *
+     * @param count Rotation count
+     */
+    void rotate_down(size_type count) noexcept;
+
+    /**
+     * @brief Check if there is a pending rotation
+     *
+     * @return true If the underlying pixels are not in logical order
+     * @return false Otherwise
+     */
+    bool rotated() const noexcept
+    {
+        return (offset != 0) || (column_offset != 0);
+    }
+
+    /**
+     * @brief Apply the pending rotation to the underlying pixels
+     *
+     * @note Afterwards, the underlying pixels are in logical order
+     *       and this view is not rotated.
+     *       All pixels are marked as dirty if the rotation was pending.
+     */
+    void compact() noexcept;
+
+    /**
+     * @brief Get the index in the underlying pixels of a pixel
+     *
+     * @param index Logical index (less than size())
+     * @return size_type Index in the underlying pixels
+     */
+    size_type physicalIndex(size_type index) const noexcept
+    {
+        assert((index < size()) && (offset < size()));
+        if (column_offset)
+        {
+            size_type column = index % row_length;
+            index += column_offset;
+            if ((column + column_offset) >= row_length)
+                index -= row_length;
+        }
+        index += offset;
+        if (index >= size())
+            index -= size();
+        return index;
+    }
+
+    /**
+     * @brief Access to a pixel
+     *
+     * @note There are no bound checks, except for assertions
+     *
+     * @param index Logical pixel index
+     * @return Pixel& Pixel
+     */
+    Pixel &operator[](size_type index) noexcept
+    {
+        return storage->data()[physicalIndex(index)];
+    }
+
+    /**
+     * @brief Access to a pixel
+     *
+     * @note There are no bound checks, except for assertions
+     *
+     * @param index Logical pixel index
+     * @return const Pixel& Pixel
+     */
+    const Pixel &operator[](size_type index) const noexcept
+    {
+        return storage->data()[physicalIndex(index)];
+    }
+
+    /**
+     * @brief Access to a pixel
+     *
+     * @note There are no bound checks, except for assertions
+     *
+     * @param row Logical row index
+     * @param col Logical column index
+     * @return Pixel& Pixel
+     */
+    Pixel &operator()(size_type row, size_type col) noexcept
+    {
+        assert(col < row_length);
+        return (*this)[(row * row_length) + col];
+    }
+
+    /**
+     * @brief Access to a pixel
+     *
+     * @note There are no bound checks, except for assertions
+     *
+     * @param row Logical row index
+     * @param col Logical column index
+     * @return const Pixel& Pixel
+     */
+    const Pixel &operator()(size_type row, size_type col) const noexcept
+    {
+        assert(col < row_length);
+        return (*this)[(row * row_length) + col];
+    }
+
+private:
+    /// @brief Underlying pixels
+    PixelVector *storage;
+    /// @brief Row length (the whole vector if not a matrix)
+    size_type row_length;
+    /// @brief Index in the underlying pixels of the first pixel
+    size_type offset = 0;
+    /// @brief Rotation within each row of the underlying pixels
+    size_type column_offset = 0;
+};
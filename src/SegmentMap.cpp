@@ -0,0 +1,77 @@
+/**
+ * @file SegmentMap.cpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Run-length mapping of folded LED strips
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 License
+ */
+
+#include "SegmentMap.hpp"
+#include <cassert>
+
+//------------------------------------------------------------------------------
+// Runs
+//------------------------------------------------------------------------------
+
+SegmentMap &SegmentMap::addSegment(
+    ::std::size_t start,
+    ::std::size_t length,
+    bool reversed,
+    ::std::size_t skip)
+{
+    assert((start <= 65535) && (length <= 65535) && (skip <= 65535));
+    assert((length + skip) > 0);
+    LedSegment run;
+    run.start = start;
+    run.length = length;
+    run.skip = skip;
+    run.reversed = reversed;
+    push_back(run);
+    return *this;
+}
+
+::std::size_t SegmentMap::ledCount() const noexcept
+{
+    ::std::size_t result = 0;
+    for (const LedSegment &run : *this)
+        result += run.skip + run.length;
+    return result;
+}
+
+::std::size_t SegmentMap::pixelCount() const noexcept
+{
+    ::std::size_t result = 0;
+    for (const LedSegment &run : *this)
+        if ((run.length > 0) && ((run.start + run.length) > result))
+            result = run.start + run.length;
+    return result;
+}
+
+//------------------------------------------------------------------------------
+// Mapping
+//------------------------------------------------------------------------------
+
+bool SegmentMap::pixelIndex(
+    ::std::size_t led_index,
+    ::std::size_t &pixel_index) const noexcept
+{
+    for (const LedSegment &run : *this)
+    {
+        if (led_index < run.skip)
+            return false;
+        led_index -= run.skip;
+        if (led_index < run.length)
+        {
+            pixel_index =
+                (run.reversed)
+                    ? (run.start + run.length - 1 - led_index)
+                    : (run.start + led_index);
+            return true;
+        }
+        led_index -= run.length;
+    }
+    return false;
+}
@@ -0,0 +1,145 @@
+/**
+ * @file SegmentMap.hpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Run-length mapping of folded LED strips
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 License
+ */
+
+#pragma once
+
+//------------------------------------------------------------------------------
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Run of consecutive LEDs in the data wire
+ *
+ */
+struct LedSegment
+{
+    /// @brief Pixel index shown by the lowest-indexed LED of this run
+    uint16_t start = 0;
+    /// @brief Count of LEDs in this run
+    uint16_t length = 0;
+    /// @brief Hidden or dead LEDs in the data wire before this run
+    /// @note Those LEDs are sent black and show no pixel
+    uint16_t skip = 0;
+    /// @brief True if pixel indices decrease along the data wire
+    bool reversed = false;
+};
+
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Pixels shown by a single LED strip routed around corners,
+ *        having reversed sections and hidden or dead LEDs
+ *
+ * @note The data wire is described as a short list of runs
+ *       (see LedSegment), in wire order.
+ *       Memory usage depends on the count of runs, not on the count of LEDs.
+ *
+ * @note The pixel vector stays contiguous: pixel `i` is
+ *       the i-th pixel along the installation, no matter how it is wired.
+ *       Install the segment map into the LED strip
+ *       (see LEDStrip::segmentMap()).
+ */
+class SegmentMap : public ::std::vector<LedSegment>
+{
+public:
+    /// @brief Inherited constructors
+    using ::std::vector<LedSegment>::vector;
+
+    /**
+     * @brief Position in the data wire while walking a segment map
+     *
+     */
+    struct Cursor
+    {
+        /// @brief Current run
+        ::std::size_t segment = 0;
+        /// @brief LEDs already walked in the current run, including skipped
+        ::std::size_t offset = 0;
+    };
+
+    /**
+     * @brief Add a run at the end of the data wire
+     *
+     * @param start Pixel index shown by the lowest-indexed LED of the run
+     * @param length Count of LEDs in the run
+     * @param reversed True if pixel indices decrease along the data wire
+     * @param skip Hidden or dead LEDs in the data wire before the run
+     * @return SegmentMap& This segment map
+     */
+    SegmentMap &addSegment(
+        ::std::size_t start,
+        ::std::size_t length,
+        bool reversed = false,
+        ::std::size_t skip = 0);
+
+    /**
+     * @brief Get the count of LEDs in the data wire, including skipped ones
+     *
+     * @return ::std::size_t Count of LEDs
+     */
+    ::std::size_t ledCount() const noexcept;
+
+    /**
+     * @brief Get the count of pixels required to show a frame
+     *
+     * @return ::std::size_t One past the highest pixel index shown
+     */
+    ::std::size_t pixelCount() const noexcept;
+
+    /**
+     * @brief Retrieve the pixel index shown by an LED
+     *
+     * @note Computed on the fly in O(runs).
+     *       Use next() to walk the whole data wire.
+     *
+     * @param led_index LED index in the data wire
+     * @param[out] pixel_index Pixel index shown by the LED
+     * @return true If the LED shows a pixel
+     * @return false If the LED is skipped or out of range
+     */
+    bool pixelIndex(
+        ::std::size_t led_index,
+        ::std::size_t &pixel_index) const noexcept;
+
+    /**
+     * @brief Walk to the next LED in the data wire
+     *
+     * @note Start with a default-constructed cursor.
+     *       Must not be called past ledCount() LEDs.
+     *
+     * @param cursor Position in the data wire. Advanced by one LED.
+     * @param[out] pixel_index Pixel index shown by the LED
+     * @return true If the LED shows a pixel
+     * @return false If the LED is skipped
+     */
+    bool next(Cursor &cursor, ::std::size_t &pixel_index) const noexcept
+    {
+        const LedSegment &run = (*this)[cursor.segment];
+        ::std::size_t offset = cursor.offset++;
+        if (cursor.offset == (run.skip + run.length))
+        {
+            cursor.segment++;
+            cursor.offset = 0;
+        }
+        if (offset < run.skip)
+            return false;
+        offset -= run.skip;
+        pixel_index =
+            (run.reversed)
+                ? (run.start + run.length - 1 - offset)
+                : (run.start + offset);
+        return true;
+    }
+};
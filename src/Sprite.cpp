@@ -0,0 +1,132 @@
+/**
+ * @file Sprite.cpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Precompiled sprites
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 License
+ */
+
+#include "Sprite.hpp"
+#include <algorithm> // For ::std::min() and ::std::max()
+#include <cstring>   // For ::std::memcpy()
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+Sprite::Sprite(const PixelMatrix &image)
+{
+    compile(image, nullptr, nullptr);
+}
+
+Sprite::Sprite(const PixelMatrix &image, const Pixel &color_key)
+{
+    compile(image, &color_key, nullptr);
+}
+
+Sprite::Sprite(const PixelMatrix &image, const ::std::vector<bool> &mask)
+{
+    compile(image, nullptr, &mask);
+}
+
+//------------------------------------------------------------------------------
+// Compilation
+//------------------------------------------------------------------------------
+
+void Sprite::compile(
+    const PixelMatrix &image,
+    const Pixel *color_key,
+    const ::std::vector<bool> *mask)
+{
+    rows = image.row_count();
+    columns = image.column_count();
+    runs.clear();
+    pixels.clear();
+    for (size_type r = 0; r < rows; r++)
+    {
+        auto opaque = [&](size_type c) -> bool
+        {
+            if (color_key)
+                return (image(r, c) != *color_key);
+            if (mask)
+            {
+                size_type bit = (r * columns) + c;
+                return (bit < mask->size()) && (*mask)[bit];
+            }
+            return true;
+        };
+        size_type c = 0;
+        while (c < columns)
+        {
+            while ((c < columns) && !opaque(c))
+                c++;
+            Run run{r, c, 0, pixels.size()};
+            while ((c < columns) && opaque(c))
+                pixels.push_back(image(r, c++));
+            run.length = c - run.column;
+            if (run.length > 0)
+                runs.push_back(run);
+        }
+    }
+    runs.shrink_to_fit();
+    pixels.shrink_to_fit();
+}
+
+//------------------------------------------------------------------------------
+// Drawing
+//------------------------------------------------------------------------------
+
+void Sprite::draw(
+    PixelMatrix &target,
+    ::std::ptrdiff_t row,
+    ::std::ptrdiff_t column) const noexcept
+{
+    const ::std::ptrdiff_t target_rows = target.row_count();
+    const ::std::ptrdiff_t target_columns = target.column_count();
+    // Clipped bounds of this sprite in the target matrix
+    ::std::ptrdiff_t top = ::std::max<::std::ptrdiff_t>(row, 0);
+    ::std::ptrdiff_t left = ::std::max<::std::ptrdiff_t>(column, 0);
+    ::std::ptrdiff_t bottom = ::std::min<::std::ptrdiff_t>(
+        row + static_cast<::std::ptrdiff_t>(rows), target_rows);
+    ::std::ptrdiff_t right = ::std::min<::std::ptrdiff_t>(
+        column + static_cast<::std::ptrdiff_t>(columns), target_columns);
+    if ((runs.size() == 0) || (top >= bottom) || (left >= right))
+        return;
+
+    target.markDirty(PixelRect{
+        static_cast<size_type>(top),
+        static_cast<size_type>(left),
+        static_cast<size_type>(bottom - top),
+        static_cast<size_type>(right - left)});
+
+    // Skip the runs above the target matrix (runs are sorted by row)
+    size_type first_row = top - row;
+    auto run = ::std::lower_bound(
+        runs.begin(),
+        runs.end(),
+        first_row,
+        [](const Run &item, size_type value)
+        { return item.row < value; });
+
+    Pixel *data = target.data();
+    for (; run != runs.end(); run++)
+    {
+        ::std::ptrdiff_t r = row + static_cast<::std::ptrdiff_t>(run->row);
+        if (r >= bottom)
+            break;
+        ::std::ptrdiff_t from = column +
+                                static_cast<::std::ptrdiff_t>(run->column);
+        ::std::ptrdiff_t to = from + static_cast<::std::ptrdiff_t>(run->length);
+        ::std::ptrdiff_t skip = ::std::max<::std::ptrdiff_t>(left - from, 0);
+        from += skip;
+        to = ::std::min(to, right);
+        if (from < to)
+            ::std::memcpy(
+                data + (r * target_columns) + from,
+                pixels.data() + run->offset + skip,
+                (to - from) * sizeof(Pixel));
+    }
+}
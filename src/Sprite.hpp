@@ -0,0 +1,151 @@
+/**
+ * @file Sprite.hpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Precompiled sprites
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 License
+ */
+
+#pragma once
+
+//------------------------------------------------------------------------------
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include "PixelVector.hpp"
+
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Image precompiled into runs of opaque pixels
+ *
+ * @note Drawing a sprite touches its opaque pixels only,
+ *       so sparse images are drawn faster than using
+ *       PixelMatrix::blit().
+ *       The sprite keeps a copy of its opaque pixels,
+ *       so later changes to the source image have no effect.
+ */
+class Sprite
+{
+public:
+    /// @brief Unsigned integer type
+    using size_type = PixelVector::size_type;
+
+    /**
+     * @brief Create an empty sprite
+     *
+     */
+    Sprite() noexcept {}
+
+    /**
+     * @brief Create a fully opaque sprite
+     *
+     * @param image Source image
+     */
+    explicit Sprite(const PixelMatrix &image);
+
+    /**
+     * @brief Create a sprite using a transparent color
+     *
+     * @param image Source image
+     * @param color_key Pixels of this color in @p image are transparent
+     */
+    Sprite(const PixelMatrix &image, const Pixel &color_key);
+
+    /**
+     * @brief Create a sprite using a transparency mask
+     *
+     * @param image Source image
+     * @param mask One boolean per pixel in @p image (row-major order).
+     *             Pixels are opaque where @p mask is true.
+     *             Missing booleans are taken as false.
+     */
+    Sprite(const PixelMatrix &image, const ::std::vector<bool> &mask);
+
+    /**
+     * @brief Draw this sprite into a matrix
+     *
+     * @note The sprite is clipped to the bounds of @p target.
+     *
+     * @param target Matrix to draw into
+     * @param row Row of the top-left pixel of this sprite in @p target.
+     *            May be negative.
+     * @param column Column of the top-left pixel of this sprite
+     *               in @p target. May be negative.
+     */
+    void draw(
+        PixelMatrix &target,
+        ::std::ptrdiff_t row,
+        ::std::ptrdiff_t column) const noexcept;
+
+    /**
+     * @brief Get the count of rows in the source image
+     *
+     * @return size_type Row count
+     */
+    size_type row_count() const noexcept { return rows; }
+
+    /**
+     * @brief Get the count of columns in the source image
+     *
+     * @return size_type Column count
+     */
+    size_type column_count() const noexcept { return columns; }
+
+    /**
+     * @brief Get the count of opaque pixels
+     *
+     * @return size_type Pixel count
+     */
+    size_type pixel_count() const noexcept { return pixels.size(); }
+
+    /**
+     * @brief Get the count of runs of opaque pixels
+     *
+     * @return size_type Run count
+     */
+    size_type run_count() const noexcept { return runs.size(); }
+
+private:
+    /**
+     * @brief Horizontal run of opaque pixels
+     *
+     */
+    struct Run
+    {
+        /// @brief Row in the source image
+        size_type row;
+        /// @brief First column in the source image
+        size_type column;
+        /// @brief Count of pixels
+        size_type length;
+        /// @brief Index of the first pixel in Sprite::pixels
+        size_type offset;
+    };
+
+    /**
+     * @brief Compile the source image into runs of opaque pixels
+     *
+     * @param image Source image
+     * @param color_key Transparent color or nullptr
+     * @param mask Transparency mask or nullptr.
+     *             Fully opaque if both @p color_key and @p mask are null.
+     */
+    void compile(
+        const PixelMatrix &image,
+        const Pixel *color_key,
+        const ::std::vector<bool> *mask);
+
+    /// @brief Runs of opaque pixels in row-major order
+    ::std::vector<Run> runs{};
+    /// @brief Opaque pixels
+    PixelVector pixels{};
+    /// @brief Row count of the source image
+    size_type rows = 0;
+    /// @brief Column count of the source image
+    size_type columns = 0;
+};
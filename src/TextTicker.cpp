@@ -0,0 +1,101 @@
+/**
+ * @file TextTicker.cpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Scrolling text
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 License
+ */
+
+#include "TextTicker.hpp"
+
+//------------------------------------------------------------------------------
+// Text
+//------------------------------------------------------------------------------
+
+TextTicker::TextTicker(
+    const char *text,
+    size_type gap,
+    const BitmapFont &font)
+    : font{font}, gap{gap}
+{
+    setText(text);
+}
+
+void TextTicker::setText(const char *text)
+{
+    size_type width = font.textWidth(text);
+    columns.assign(width + gap, 0);
+    offset = 0;
+    size_type column = 0;
+    if (text)
+        for (; *text; text++)
+            if (font.contains(*text))
+            {
+                column += font.rasterize(*text, columns.data() + column);
+                column += font.spacing();
+            }
+    // Note: at least one column to avoid divisions by zero
+    if (columns.size() == 0)
+        columns.push_back(0);
+}
+
+//------------------------------------------------------------------------------
+// Scrolling
+//------------------------------------------------------------------------------
+
+void TextTicker::advance(::std::ptrdiff_t count) noexcept
+{
+    ::std::ptrdiff_t n = columns.size();
+    count %= n;
+    if (count < 0)
+        count += n;
+    offset = (offset + count) % n;
+}
+
+void TextTicker::setPosition(size_type column) noexcept
+{
+    offset = column % columns.size();
+}
+
+//------------------------------------------------------------------------------
+// Rendering
+//------------------------------------------------------------------------------
+
+void TextTicker::draw(
+    PixelMatrix &target,
+    ::std::ptrdiff_t row,
+    const Pixel &color,
+    const Pixel &background) const noexcept
+{
+    const ::std::ptrdiff_t rows = target.row_count();
+    const size_type width = target.column_count();
+    ::std::ptrdiff_t top = (row < 0) ? 0 : row;
+    ::std::ptrdiff_t bottom = row + font.height();
+    if (bottom > rows)
+        bottom = rows;
+    if ((top >= bottom) || (width == 0))
+        return;
+
+    target.markDirty(PixelRect{
+        static_cast<size_type>(top),
+        0,
+        static_cast<size_type>(bottom - top),
+        width});
+
+    Pixel *pixels = target.data();
+    for (::std::ptrdiff_t r = top; r < bottom; r++)
+    {
+        uint32_t bit = 1UL << (r - row);
+        Pixel *target_row = pixels + (r * width);
+        size_type source = offset;
+        for (size_type c = 0; c < width; c++)
+        {
+            target_row[c] = (columns[source] & bit) ? color : background;
+            if (++source == columns.size())
+                source = 0;
+        }
+    }
+}
@@ -0,0 +1,118 @@
+/**
+ * @file TextTicker.hpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Scrolling text
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 License
+ */
+
+#pragma once
+
+//------------------------------------------------------------------------------
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "BitmapFont.hpp"
+
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Text scrolling from right to left in a loop
+ *
+ * @note The text is rasterized once into a 1-bit column buffer,
+ *       so the cost of each frame depends on the width of the
+ *       display, not on the length of the text.
+ */
+class TextTicker
+{
+public:
+    /// @brief Unsigned integer type
+    using size_type = PixelVector::size_type;
+
+    /**
+     * @brief Create a ticker
+     *
+     * @param text Null-terminated text
+     * @param gap Unlit columns between repetitions of @p text
+     * @param font Font
+     */
+    TextTicker(
+        const char *text,
+        size_type gap,
+        const BitmapFont &font = BitmapFont::standard());
+
+    /**
+     * @brief Replace the text
+     *
+     * @note The ticker restarts at the first column of @p text.
+     *
+     * @param text Null-terminated text
+     */
+    void setText(const char *text);
+
+    /**
+     * @brief Move the text to the left
+     *
+     * @param count Count of columns. Negative values move to the right.
+     */
+    void advance(::std::ptrdiff_t count = 1) noexcept;
+
+    /**
+     * @brief Get the column shown at the left of the display
+     *
+     * @return size_type Column in the range [0, period())
+     */
+    size_type position() const noexcept { return offset; }
+
+    /**
+     * @brief Set the column shown at the left of the display
+     *
+     * @param column Any column. Taken modulo period().
+     */
+    void setPosition(size_type column) noexcept;
+
+    /**
+     * @brief Get the count of columns before the text repeats
+     *
+     * @return size_type Width of the text plus the gap
+     */
+    size_type period() const noexcept { return columns.size(); }
+
+    /**
+     * @brief Get the glyph height
+     *
+     * @return size_type Height in pixels
+     */
+    size_type height() const noexcept { return font.height(); }
+
+    /**
+     * @brief Compose the visible window into a matrix
+     *
+     * @note Every pixel in the window is overwritten.
+     *
+     * @param target Matrix to draw into
+     * @param row Row of the top of the text in @p target.
+     *            Rows out of bounds are clipped.
+     * @param color Color of lit pixels
+     * @param background Color of unlit pixels
+     */
+    void draw(
+        PixelMatrix &target,
+        ::std::ptrdiff_t row,
+        const Pixel &color,
+        const Pixel &background = Pixel()) const noexcept;
+
+private:
+    /// @brief Font
+    const BitmapFont &font;
+    /// @brief Unlit columns between repetitions of the text
+    size_type gap;
+    /// @brief Rasterized text plus gap (bit N set if row N is lit)
+    ::std::vector<uint32_t> columns{};
+    /// @brief Column shown at the left of the display
+    size_type offset = 0;
+};
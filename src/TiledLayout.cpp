@@ -0,0 +1,135 @@
+/**
+ * @file TiledLayout.cpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Several LED matrix panels working as a single canvas
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 License
+ */
+
+#include "TiledLayout.hpp"
+#include <algorithm> // For ::std::upper_bound()
+#include <cassert>
+
+//------------------------------------------------------------------------------
+// Panels
+//------------------------------------------------------------------------------
+
+TiledLayout::TiledLayout(
+    const LedMatrixParameters &grid,
+    const LedMatrixParameters &panel)
+    : rows{grid.row_count * panel.row_count},
+      columns{grid.column_count * panel.column_count}
+{
+    panels.reserve(grid.size());
+    first_index.reserve(grid.size());
+    for (::std::size_t i = 0; i < grid.size(); i++)
+    {
+        ::std::size_t grid_row, grid_column;
+        grid.indexToCoordinates(i, grid_row, grid_column);
+        addPanel(
+            grid_row * panel.row_count,
+            grid_column * panel.column_count,
+            panel);
+    }
+}
+
+void TiledLayout::addPanel(
+    ::std::size_t row,
+    ::std::size_t column,
+    const LedMatrixParameters &params)
+{
+    assert((row + params.row_count) <= rows);
+    assert((column + params.column_count) <= columns);
+#ifndef NDEBUG
+    for (const LedPanel &other : panels)
+        assert(
+            ((row + params.row_count) <= other.row) ||
+            ((other.row + other.params.row_count) <= row) ||
+            ((column + params.column_count) <= other.column) ||
+            ((other.column + other.params.column_count) <= column));
+#endif
+    LedPanel panel;
+    panel.row = row;
+    panel.column = column;
+    panel.params = params;
+    panels.push_back(panel);
+    first_index.push_back(led_count);
+    led_count += params.size();
+}
+
+void TiledLayout::panelParameters(
+    ::std::size_t index,
+    const LedMatrixParameters &params) noexcept
+{
+    assert(index < panels.size());
+    assert(params.row_count == panels[index].params.row_count);
+    assert(params.column_count == panels[index].params.column_count);
+    panels[index].params = params;
+}
+
+LedMatrixParameters TiledLayout::parameters() const noexcept
+{
+    LedMatrixParameters result;
+    result.row_count = rows;
+    result.column_count = columns;
+    result.first_pixel = LedMatrixFirstPixel::top_left;
+    result.arrangement = LedMatrixArrangement::rows;
+    result.wiring = LedMatrixWiring::linear;
+    return result;
+}
+
+//------------------------------------------------------------------------------
+// Mapping
+//------------------------------------------------------------------------------
+
+::std::size_t TiledLayout::canonicalIndex(::std::size_t index) const noexcept
+{
+    assert(index < led_count);
+    // Note: the last panel whose first LED is not past the given index
+    auto it = ::std::upper_bound(first_index.begin(), first_index.end(), index);
+    ::std::size_t panel_index = (it - first_index.begin()) - 1;
+    const LedPanel &panel = panels[panel_index];
+    ::std::size_t row, column;
+    panel.params.indexToCoordinates(
+        index - first_index[panel_index],
+        row,
+        column);
+    return ((panel.row + row) * columns) + panel.column + column;
+}
+
+void TiledLayout::mapPanel(
+    ::std::size_t panel_index,
+    WireMap &map) const noexcept
+{
+    const LedPanel &panel = panels[panel_index];
+    WireMap::index_type *entry = map.data() + first_index[panel_index];
+    for (::std::size_t i = 0; i < panel.params.size(); i++)
+    {
+        ::std::size_t row, column;
+        panel.params.indexToCoordinates(i, row, column);
+        entry[i] = ((panel.row + row) * columns) + panel.column + column;
+    }
+}
+
+WireMap TiledLayout::wireMap() const
+{
+    if (!WireMap::fits(rows, columns))
+        return WireMap();
+    WireMap map(led_count);
+    map.row_count = rows;
+    map.column_count = columns;
+    for (::std::size_t i = 0; i < panels.size(); i++)
+        mapPanel(i, map);
+    return map;
+}
+
+void TiledLayout::wireMap(WireMap &map, ::std::size_t index) const noexcept
+{
+    assert(index < panels.size());
+    // Note: the map is empty if the canvas is too large
+    if ((index < panels.size()) && (map.size() == led_count))
+        mapPanel(index, map);
+}
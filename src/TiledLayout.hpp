@@ -0,0 +1,210 @@
+/**
+ * @file TiledLayout.hpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Several LED matrix panels working as a single canvas
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 License
+ */
+
+#pragma once
+
+//------------------------------------------------------------------------------
+
+#include <vector>
+#include <cstddef>
+#include "PixelDriver.hpp"
+#include "WireMap.hpp"
+
+//------------------------------------------------------------------------------
+
+/**
+ * @brief LED matrix panel placed in a canvas
+ *
+ */
+struct LedPanel
+{
+    /// @brief Canvas row of the top-left pixel of this panel
+    ::std::size_t row = 0;
+    /// @brief Canvas column of the top-left pixel of this panel
+    ::std::size_t column = 0;
+    /// @brief Working parameters of this panel, as mounted in the canvas
+    LedMatrixParameters params;
+};
+
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Several LED matrix panels daisy-chained in a single data wire
+ *        and working as a single canvas
+ *
+ * @note Each panel has its own working parameters,
+ *       so each one may be mounted in its own orientation.
+ *       Panels are chained in the order they were added.
+ *
+ * @note The canvas is a PixelMatrix having row_count() rows
+ *       and column_count() columns.
+ *       Canvas pixels not covered by any panel are not shown.
+ */
+class TiledLayout
+{
+public:
+    /**
+     * @brief Create a canvas with no panels
+     *
+     * @param row_count Number of rows in the canvas
+     * @param column_count Number of columns in the canvas
+     */
+    TiledLayout(::std::size_t row_count, ::std::size_t column_count) noexcept
+        : rows{row_count}, columns{column_count} {}
+
+    /**
+     * @brief Create a grid of identical panels
+     *
+     * @param grid Chaining order of the panels.
+     *             For example, two rows of four panels, the first
+     *             one in the top-left corner, chained in serpentine:
+     *             `{2, 4, top_left, rows, serpentine}`.
+     * @param panel Working parameters of all panels
+     */
+    TiledLayout(
+        const LedMatrixParameters &grid,
+        const LedMatrixParameters &panel);
+
+    /**
+     * @brief Add a panel at the end of the chain
+     *
+     * @warning The panel must fit in the canvas
+     *          and must not overlap other panels.
+     *          Checked with assertions, only.
+     *
+     * @param row Canvas row of the top-left pixel of the panel
+     * @param column Canvas column of the top-left pixel of the panel
+     * @param params Working parameters of the panel
+     */
+    void addPanel(
+        ::std::size_t row,
+        ::std::size_t column,
+        const LedMatrixParameters &params);
+
+    /**
+     * @brief Get the number of rows in the canvas
+     *
+     * @return ::std::size_t Number of rows
+     */
+    ::std::size_t row_count() const noexcept { return rows; }
+
+    /**
+     * @brief Get the number of columns in the canvas
+     *
+     * @return ::std::size_t Number of columns
+     */
+    ::std::size_t column_count() const noexcept { return columns; }
+
+    /**
+     * @brief Get the count of LEDs in all panels
+     *
+     * @return ::std::size_t Count of LEDs
+     */
+    ::std::size_t size() const noexcept { return led_count; }
+
+    /**
+     * @brief Get the count of panels
+     *
+     * @return ::std::size_t Count of panels
+     */
+    ::std::size_t panelCount() const noexcept { return panels.size(); }
+
+    /**
+     * @brief Get a panel
+     *
+     * @param index Position of the panel in the chain
+     * @return const LedPanel& Panel
+     */
+    const LedPanel &panel(::std::size_t index) const noexcept
+    {
+        return panels[index];
+    }
+
+    /**
+     * @brief Change the working parameters of a mounted panel
+     *
+     * @note Intended to change the orientation of a panel
+     *       (flips, or rotations if the panel is square).
+     *       Call wireMap(map, index) afterwards to update a wire map.
+     *
+     * @param index Position of the panel in the chain
+     * @param params New working parameters. Must have the same
+     *               number of rows and columns.
+     */
+    void panelParameters(
+        ::std::size_t index,
+        const LedMatrixParameters &params) noexcept;
+
+    /**
+     * @brief Get the working parameters of the whole canvas
+     *
+     * @note Suitable to build an LED strip having size() LEDs
+     *       before installing the wire map.
+     *
+     * @return LedMatrixParameters Canvas size
+     *         (single panel, top-left first, linear rows)
+     */
+    LedMatrixParameters parameters() const noexcept;
+
+    /**
+     * @brief Retrieve the canonical index (in the canvas)
+     *        of the given pixel index (in the data wire)
+     *
+     * @note Computed on the fly. Use wireMap() instead
+     *       for the whole canvas.
+     *
+     * @param index Pixel index in the data wire
+     * @return ::std::size_t Canonical pixel index
+     */
+    ::std::size_t canonicalIndex(::std::size_t index) const noexcept;
+
+    /**
+     * @brief Build the wire map of this layout
+     *
+     * @return WireMap Canonical index of each LED in wire order.
+     *                 Empty if the canvas has more than
+     *                 WireMap::max_canvas_size pixels.
+     */
+    WireMap wireMap() const;
+
+    /**
+     * @brief Update the entries of a single panel in a wire map
+     *
+     * @note Entries of other panels are not touched,
+     *       so the cost depends on the size of the panel.
+     *
+     * @note Does nothing if @p map is empty
+     *
+     * @param map Wire map previously built by wireMap()
+     * @param index Position of the panel in the chain
+     */
+    void wireMap(WireMap &map, ::std::size_t index) const noexcept;
+
+private:
+    /// @brief Number of rows in the canvas
+    ::std::size_t rows;
+    /// @brief Number of columns in the canvas
+    ::std::size_t columns;
+    /// @brief Count of LEDs in all panels
+    ::std::size_t led_count = 0;
+    /// @brief Panels in chain order
+    ::std::vector<LedPanel> panels;
+    /// @brief Pixel index of the first LED in each panel
+    ::std::vector<::std::size_t> first_index;
+
+    /**
+     * @brief Map the LEDs of a single panel
+     *
+     * @param panel_index Position of the panel in the chain
+     * @param map Destination. Must have room for all LEDs.
+     */
+    void mapPanel(::std::size_t panel_index, WireMap &map) const noexcept;
+};
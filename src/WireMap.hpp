@@ -0,0 +1,81 @@
+/**
+ * @file WireMap.hpp
+ *
+ * @author Ángel Fernández Pineda. Madrid. Spain. 2026.
+ * @brief Precomputed mapping from wire order to canvas pixels
+ *
+ * @date 2026-10-16
+ *
+ * @copyright Under EUPL 1.2 License
+ */
+
+#pragma once
+
+//------------------------------------------------------------------------------
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Canvas pixel shown by each LED, in wire order
+ *
+ * @note Element `i` is the canonical index
+ *       (row * column_count + column) of the canvas pixel
+ *       shown by the i-th LED in the data wire.
+ *       Two bytes per LED, so the canvas is limited to
+ *       max_canvas_size pixels. Layouts build an empty wire map
+ *       for larger canvases.
+ *
+ * @note Built by layouts (see TiledLayout) and
+ *       installed into an LED strip (see LEDStrip::wireMap()),
+ *       so there is no per-pixel mapping logic at show time.
+ */
+struct WireMap : public ::std::vector<uint16_t>
+{
+public:
+    /// @brief Type of the canonical indices
+    using index_type = uint16_t;
+
+    /// @brief Maximum count of pixels in the canvas
+    static constexpr ::std::size_t max_canvas_size = 65536;
+
+    /// @brief Inherited constructors
+    using ::std::vector<uint16_t>::vector;
+
+    /// @brief Number of rows in the canvas
+    ::std::size_t row_count = 0;
+    /// @brief Number of columns in the canvas
+    ::std::size_t column_count = 0;
+
+    /**
+     * @brief Get the count of pixels in the canvas
+     *
+     * @note Not to be confused with the count of LEDs (size())
+     *
+     * @return ::std::size_t Canvas size in pixels
+     */
+    ::std::size_t canvasSize() const noexcept
+    {
+        return row_count * column_count;
+    }
+
+    /**
+     * @brief Check if a canvas can be mapped
+     *
+     * @param row_count Number of rows in the canvas
+     * @param column_count Number of columns in the canvas
+     * @return true If the canvas has max_canvas_size pixels or less
+     * @return false Otherwise
+     */
+    static constexpr bool fits(
+        ::std::size_t row_count,
+        ::std::size_t column_count) noexcept
+    {
+        // Note: no overflow in the product
+        return (row_count == 0) ||
+               (column_count <= (max_canvas_size / row_count));
+    }
+};